@@ -0,0 +1,145 @@
+/**
+  ******************************************************************************
+  * @file    mx25r3235f.h
+  * @author  MCD Application Team
+  * @brief   Host build of the XSPI BSP: MX25R3235F component driver interface,
+  *          limited to the functions used by stm32wbaxx_nucleo_xspi.c.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MX25R3235F_H
+#define MX25R3235F_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32wbaxx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define MX25R3235F_FLASH_SIZE              0x400000U  /* 32 Mbits => 4MBytes */
+#define MX25R3235F_SECTOR_64K              0x10000U   /* 64 blocks of 64KBytes */
+#define MX25R3235F_BLOCK_32K               0x8000U    /* 128 blocks of 32KBytes */
+#define MX25R3235F_SUBSECTOR_4K            0x1000U    /* 1024 sectors of 4KBytes */
+#define MX25R3235F_PAGE_SIZE               0x100U     /* 16384 pages of 256 Bytes */
+
+#define MX25R3235F_OK                      0
+#define MX25R3235F_ERROR                   -1
+
+/* Commands */
+#define MX25R3235F_READ_CMD                0x03U      /* Normal Read 1-1-1 */
+#define MX25R3235F_FAST_READ_CMD           0x0BU      /* Fast Read 1-1-1 */
+#define MX25R3235F_4READ_CMD               0xEBU      /* Quad I/O Read 1-4-4 */
+#define MX25R3235F_PAGE_PROG_CMD           0x02U      /* Page Program 1-1-1 */
+#define MX25R3235F_QUAD_PAGE_PROG_CMD      0x38U      /* Quad Page Program 1-4-4 */
+#define MX25R3235F_SECTOR_ERASE_CMD        0x20U      /* Sector Erase 4KB */
+#define MX25R3235F_BLOCK_ERASE_32K_CMD     0x52U      /* Block Erase 32KB */
+#define MX25R3235F_BLOCK_ERASE_CMD         0xD8U      /* Block Erase 64KB */
+#define MX25R3235F_CHIP_ERASE_CMD          0x60U      /* Chip Erase */
+#define MX25R3235F_WRITE_ENABLE_CMD        0x06U      /* Write Enable */
+#define MX25R3235F_WRITE_DISABLE_CMD       0x04U      /* Write Disable */
+#define MX25R3235F_READ_STATUS_REG_CMD     0x05U      /* Read Status Register */
+#define MX25R3235F_WRITE_STATUS_REG_CMD    0x01U      /* Write Status and Configuration Registers */
+#define MX25R3235F_READ_SECURITY_REG_CMD   0x2BU      /* Read Security Register */
+#define MX25R3235F_PROG_ERASE_SUSPEND_CMD  0xB0U      /* Program/Erase Suspend */
+#define MX25R3235F_PROG_ERASE_RESUME_CMD   0x30U      /* Program/Erase Resume */
+#define MX25R3235F_DEEP_POWER_DOWN_CMD     0xB9U      /* Deep Power-down */
+#define MX25R3235F_NO_OPERATION_CMD        0x00U      /* No Operation */
+#define MX25R3235F_READ_ID_CMD             0x9FU      /* Read Identification */
+#define MX25R3235F_RESET_ENABLE_CMD        0x66U      /* Reset Enable */
+#define MX25R3235F_RESET_MEMORY_CMD        0x99U      /* Reset Memory */
+
+#define MX25R3235F_DUMMY_CYCLES_READ       8U         /* Dummy cycles of FAST_READ */
+#define MX25R3235F_DUMMY_CYCLES_READ_QUAD  4U         /* Dummy cycles of 4READ after the mode bits */
+#define MX25R3235F_ALT_BYTES_NO_PE_MODE    0xAAU      /* 4READ mode bits: no performance enhance */
+
+/* Status register */
+#define MX25R3235F_SR_WIP                  0x01U      /* Write in progress */
+#define MX25R3235F_SR_WEL                  0x02U      /* Write enable latch */
+#define MX25R3235F_SR_BP                   0x3CU      /* Block protect */
+#define MX25R3235F_SR_QE                   0x40U      /* Quad enable */
+#define MX25R3235F_SR_SRWD                 0x80U      /* Status register write disable */
+
+/* Security register */
+#define MX25R3235F_SECR_SOI                0x01U      /* Secured OTP indicator */
+#define MX25R3235F_SECR_LDSO               0x02U      /* Lock-down secured OTP */
+#define MX25R3235F_SECR_PSB                0x04U      /* Program suspend bit */
+#define MX25R3235F_SECR_ESB                0x08U      /* Erase suspend bit */
+#define MX25R3235F_SECR_P_FAIL             0x20U      /* Program fail flag */
+#define MX25R3235F_SECR_E_FAIL             0x40U      /* Erase fail flag */
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t FlashSize;             /*!< Size of the flash                             */
+  uint32_t EraseSectorSize;       /*!< Size of sectors for the erase operation       */
+  uint32_t EraseSectorsNumber;    /*!< Number of sectors for the erase operation     */
+  uint32_t EraseSubSectorSize;    /*!< Size of subsector for the erase operation     */
+  uint32_t EraseSubSectorNumber;  /*!< Number of subsector for the erase operation   */
+  uint32_t EraseSubSector1Size;   /*!< Size of subsector 1 for the erase operation   */
+  uint32_t EraseSubSector1Number; /*!< Number of subsector 1 for the erase operation */
+  uint32_t ProgPageSize;          /*!< Size of pages for the program operation       */
+  uint32_t ProgPagesNumber;       /*!< Number of pages for the program operation     */
+} MX25R3235F_Info_t;
+
+typedef enum
+{
+  MX25R3235F_SPI_MODE = 0,        /*!< 1-1-1 commands, Power on H/W default setting */
+  MX25R3235F_DUAL_OUT_MODE,       /*!< 1-1-2 read commands                          */
+  MX25R3235F_DUAL_IO_MODE,        /*!< 1-2-2 read commands                          */
+  MX25R3235F_QUAD_OUT_MODE,       /*!< 1-1-4 read commands                          */
+  MX25R3235F_QUAD_IO_MODE         /*!< 1-4-4 read and program commands              */
+} MX25R3235F_Interface_t;
+
+typedef enum
+{
+  MX25R3235F_STR_TRANSFER = 0     /*!< Single Transfer Rate */
+} MX25R3235F_Transfer_t;
+
+typedef enum
+{
+  MX25R3235F_ERASE_4K = 0,        /*!< 4K size Sector erase  */
+  MX25R3235F_ERASE_32K,           /*!< 32K size Block erase  */
+  MX25R3235F_ERASE_64K,           /*!< 64K size Block erase  */
+  MX25R3235F_ERASE_CHIP           /*!< Whole chip erase      */
+} MX25R3235F_Erase_t;
+
+/* Exported functions --------------------------------------------------------*/
+int32_t MX25R3235F_GetFlashInfo(MX25R3235F_Info_t *pInfo);
+int32_t MX25R3235F_Read(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint8_t *pData,
+                        uint32_t ReadAddr, uint32_t Size);
+int32_t MX25R3235F_PageProgram(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint8_t *pData,
+                               uint32_t WriteAddr, uint32_t Size);
+int32_t MX25R3235F_BlockErase(XSPI_HandleTypeDef *Ctx, uint32_t BlockAddress, MX25R3235F_Erase_t BlockSize);
+int32_t MX25R3235F_ChipErase(XSPI_HandleTypeDef *Ctx);
+int32_t MX25R3235F_EnableMemoryMappedMode(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode);
+int32_t MX25R3235F_Suspend(XSPI_HandleTypeDef *Ctx);
+int32_t MX25R3235F_Resume(XSPI_HandleTypeDef *Ctx);
+int32_t MX25R3235F_WriteEnable(XSPI_HandleTypeDef *Ctx);
+int32_t MX25R3235F_WriteDisable(XSPI_HandleTypeDef *Ctx);
+int32_t MX25R3235F_ReadStatusRegister(XSPI_HandleTypeDef *Ctx, uint8_t *Value);
+int32_t MX25R3235F_WriteStatusRegister(XSPI_HandleTypeDef *Ctx, uint8_t Value);
+int32_t MX25R3235F_ReadSecurityRegister(XSPI_HandleTypeDef *Ctx, uint8_t *Value);
+int32_t MX25R3235F_EnterPowerDown(XSPI_HandleTypeDef *Ctx);
+int32_t MX25R3235F_NoOperation(XSPI_HandleTypeDef *Ctx);
+int32_t MX25R3235F_ReadID(XSPI_HandleTypeDef *Ctx, uint8_t *ID);
+int32_t MX25R3235F_ResetEnable(XSPI_HandleTypeDef *Ctx);
+int32_t MX25R3235F_ResetMemory(XSPI_HandleTypeDef *Ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MX25R3235F_H */
@@ -0,0 +1,613 @@
+/**
+  ******************************************************************************
+  * @file    stm32wbaxx_hal.h
+  * @author  MCD Application Team
+  * @brief   Host build of the XSPI BSP: subset of the HAL and CMSIS definitions
+  *          used by stm32wbaxx_nucleo_xspi.c, implemented by hal_host.c on a
+  *          virtual time base and the MX25R3235F model of flash_model.c.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32WBAXX_HAL_H
+#define STM32WBAXX_HAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+
+/* Device and modules ---------------------------------------------------------*/
+#define STM32WBA65xx                  1
+#define HAL_XSPI_MODULE_ENABLED
+#define HAL_DMA_MODULE_ENABLED
+#define HAL_CRC_MODULE_ENABLED
+#define HAL_ICACHE_MODULE_ENABLED
+#define HAL_UART_MODULE_ENABLED
+
+#ifndef USE_HAL_XSPI_REGISTER_CALLBACKS
+#define USE_HAL_XSPI_REGISTER_CALLBACKS 0U
+#endif /* USE_HAL_XSPI_REGISTER_CALLBACKS */
+#ifndef USE_HAL_UART_REGISTER_CALLBACKS
+#define USE_HAL_UART_REGISTER_CALLBACKS 0U
+#endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+
+/* Common definitions ---------------------------------------------------------*/
+#define __weak                        __attribute__((weak))
+#define __IO                          volatile
+#define UNUSED(X)                     (void)(X)
+
+#define SET_BIT(REG, BIT)             ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)           ((REG) &= ~(BIT))
+#define READ_BIT(REG, BIT)            ((REG) & (BIT))
+#define MODIFY_REG(REG, CLEARMASK, SETMASK) ((REG) = (((REG) & (~(CLEARMASK))) | (SETMASK)))
+#define POSITION_VAL(VAL)             ((uint32_t)__builtin_ctz(VAL))
+
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+  RESET = 0U,
+  SET = !RESET
+} FlagStatus;
+
+typedef enum
+{
+  DISABLE = 0U,
+  ENABLE = !DISABLE
+} FunctionalState;
+
+/* CMSIS core ----------------------------------------------------------------*/
+typedef int32_t IRQn_Type;
+
+#define XSPI1_IRQn                    70
+#define GPDMA1_Channel6_IRQn          35
+#define GPDMA1_Channel7_IRQn          36
+
+typedef struct
+{
+  __IO uint32_t CTRL;
+  __IO uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+  __IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+#define DWT_CTRL_CYCCNTENA_Msk        (1UL << 0U)
+#define CoreDebug_DEMCR_TRCENA_Msk    (1UL << 24U)
+
+/* Each access to the cycle counter takes a few cycles of the virtual time */
+DWT_Type *HOST_DwtAccess(void);
+extern CoreDebug_Type HOST_CoreDebug;
+#define DWT                           (HOST_DwtAccess())
+#define CoreDebug                     (&HOST_CoreDebug)
+
+#define __CLZ(VAL)                    ((uint8_t)(((VAL) == 0U) ? 32U : (uint32_t)__builtin_clz(VAL)))
+
+extern uint32_t SystemCoreClock;
+
+uint32_t __get_PRIMASK(void);
+uint32_t __get_IPSR(void);
+void     __set_PRIMASK(uint32_t PriMask);
+void     __disable_irq(void);
+void     __enable_irq(void);
+void     __WFI(void);
+void     __DSB(void);
+void     __ISB(void);
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+
+uint32_t HAL_GetTick(void);
+void     HAL_Delay(uint32_t Delay);
+uint32_t HAL_RCC_GetHCLKFreq(void);
+
+/* Peripherals ---------------------------------------------------------------*/
+typedef struct
+{
+  __IO uint32_t CR;
+  __IO uint32_t DCR1;
+  __IO uint32_t DCR2;
+  __IO uint32_t SR;
+  __IO uint32_t FCR;
+  __IO uint32_t DR;
+} XSPI_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t DR;
+  __IO uint32_t IDR;
+  __IO uint32_t CR;
+  __IO uint32_t INIT;
+  __IO uint32_t POL;
+} CRC_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR;
+} ICACHE_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CBR;
+} DMA_Channel_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t MODER;
+} GPIO_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR1;
+} USART_TypeDef;
+
+extern XSPI_TypeDef        HOST_Xspi1;
+extern CRC_TypeDef         HOST_Crc;
+extern ICACHE_TypeDef      HOST_ICache;
+extern DMA_Channel_TypeDef HOST_DmaChannel[8];
+extern GPIO_TypeDef        HOST_Gpio[8];
+extern USART_TypeDef       HOST_Usart1;
+
+/* The memory-mapped window is the image of the memory model */
+extern uint8_t *HOST_XspiWindow;
+
+#define XSPI1                         (&HOST_Xspi1)
+#define XSPI1_BASE                    ((uintptr_t)HOST_XspiWindow)
+#define CRC                           (&HOST_Crc)
+#define ICACHE                        (&HOST_ICache)
+#define GPDMA1_Channel6               (&HOST_DmaChannel[6])
+#define GPDMA1_Channel7               (&HOST_DmaChannel[7])
+#define GPIOA                         (&HOST_Gpio[0])
+#define GPIOB                         (&HOST_Gpio[1])
+#define GPIOC                         (&HOST_Gpio[2])
+#define GPIOD                         (&HOST_Gpio[3])
+#define USART1                        (&HOST_Usart1)
+
+#define ICACHE_CR_EN                  (1UL << 0U)
+#define XSPI_CR_FMODE                 (0x3UL << 28U)
+
+/* RCC -----------------------------------------------------------------------*/
+#define __HAL_RCC_XSPI1_CLK_ENABLE()      do { } while (0)
+#define __HAL_RCC_XSPI1_CLK_DISABLE()     do { } while (0)
+#define __HAL_RCC_XSPI1_FORCE_RESET()     do { } while (0)
+#define __HAL_RCC_XSPI1_RELEASE_RESET()   do { } while (0)
+#define __HAL_RCC_GPIOA_CLK_ENABLE()      do { } while (0)
+#define __HAL_RCC_GPIOB_CLK_ENABLE()      do { } while (0)
+#define __HAL_RCC_GPIOC_CLK_ENABLE()      do { } while (0)
+#define __HAL_RCC_GPIOD_CLK_ENABLE()      do { } while (0)
+#define __HAL_RCC_GPDMA1_CLK_ENABLE()     do { } while (0)
+#define __HAL_RCC_CRC_CLK_ENABLE()        do { } while (0)
+#define __HAL_RCC_CRC_CLK_DISABLE()       do { } while (0)
+#define __HAL_RCC_CRC_IS_CLK_ENABLED()    (1U)
+#define __HAL_RCC_USART1_CLK_ENABLE()     do { } while (0)
+#define __HAL_RCC_USART1_CLK_DISABLE()    do { } while (0)
+
+/* GPIO ----------------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Pin;
+  uint32_t Mode;
+  uint32_t Pull;
+  uint32_t Speed;
+  uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+#define GPIO_PIN_0                    0x0001U
+#define GPIO_PIN_1                    0x0002U
+#define GPIO_PIN_2                    0x0004U
+#define GPIO_PIN_3                    0x0008U
+#define GPIO_PIN_4                    0x0010U
+#define GPIO_PIN_5                    0x0020U
+#define GPIO_PIN_6                    0x0040U
+#define GPIO_PIN_7                    0x0080U
+#define GPIO_PIN_8                    0x0100U
+#define GPIO_PIN_9                    0x0200U
+#define GPIO_PIN_10                   0x0400U
+#define GPIO_PIN_11                   0x0800U
+#define GPIO_PIN_12                   0x1000U
+#define GPIO_PIN_13                   0x2000U
+#define GPIO_PIN_14                   0x4000U
+#define GPIO_PIN_15                   0x8000U
+#define GPIO_MODE_AF_PP               0x02U
+#define GPIO_NOPULL                   0x00U
+#define GPIO_PULLUP                   0x01U
+#define GPIO_SPEED_FREQ_HIGH          0x02U
+#define GPIO_SPEED_FREQ_VERY_HIGH     0x03U
+#define GPIO_AF7_USART1               0x07U
+#define GPIO_AF10_USART1              0x0AU
+#define GPIO_AF10_XSPI1               0x0AU
+#define GPIO_AF11_XSPI1               0x0BU
+#define GPIO_AF13_XSPI1               0x0DU
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, const GPIO_InitTypeDef *pGPIO_Init);
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin);
+
+/* DMA -----------------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Request;
+  uint32_t BlkHWRequest;
+  uint32_t Direction;
+  uint32_t SrcInc;
+  uint32_t DestInc;
+  uint32_t SrcDataWidth;
+  uint32_t DestDataWidth;
+  uint32_t Priority;
+  uint32_t SrcBurstLength;
+  uint32_t DestBurstLength;
+  uint32_t TransferAllocatedPort;
+  uint32_t TransferEventMode;
+  uint32_t Mode;
+} DMA_InitTypeDef;
+
+typedef struct __DMA_HandleTypeDef
+{
+  DMA_Channel_TypeDef *Instance;
+  DMA_InitTypeDef      Init;
+  void                *Parent;
+} DMA_HandleTypeDef;
+
+#define GPDMA1_REQUEST_XSPI1          40U
+#define DMA_BREQ_SINGLE_BURST         0U
+#define DMA_PERIPH_TO_MEMORY          1U
+#define DMA_MEMORY_TO_MEMORY          2U
+#define DMA_MEMORY_TO_PERIPH          3U
+#define DMA_SINC_FIXED                0U
+#define DMA_SINC_INCREMENTED          1U
+#define DMA_DINC_FIXED                0U
+#define DMA_DINC_INCREMENTED          1U
+#define DMA_SRC_DATAWIDTH_BYTE        0U
+#define DMA_SRC_DATAWIDTH_WORD        2U
+#define DMA_DEST_DATAWIDTH_BYTE       0U
+#define DMA_DEST_DATAWIDTH_WORD       2U
+#define DMA_LOW_PRIORITY_HIGH_WEIGHT  2U
+#define DMA_SRC_ALLOCATED_PORT0       0U
+#define DMA_SRC_ALLOCATED_PORT1       2U
+#define DMA_DEST_ALLOCATED_PORT0      0U
+#define DMA_DEST_ALLOCATED_PORT1      1U
+#define DMA_TCEM_BLOCK_TRANSFER       0U
+#define DMA_NORMAL                    0U
+
+#define __HAL_LINKDMA(__HANDLE__, __PPP_DMA_FIELD__, __DMA_HANDLE__) \
+  do { \
+    (__HANDLE__)->__PPP_DMA_FIELD__ = &(__DMA_HANDLE__); \
+    (__DMA_HANDLE__).Parent = (__HANDLE__); \
+  } while (0)
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma);
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma);
+
+/* XSPI ----------------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t FifoThresholdByte;
+  uint32_t MemoryMode;
+  uint32_t MemoryType;
+  uint32_t MemorySize;
+  uint32_t ChipSelectHighTimeCycle;
+  uint32_t FreeRunningClock;
+  uint32_t ClockMode;
+  uint32_t WrapSize;
+  uint32_t ClockPrescaler;
+  uint32_t SampleShifting;
+  uint32_t DelayHoldQuarterCycle;
+  uint32_t ChipSelectBoundary;
+  uint32_t MaxTran;
+  uint32_t Refresh;
+  uint32_t MemorySelect;
+} XSPI_InitTypeDef;
+
+#define HAL_XSPI_STATE_RESET          0x00U
+#define HAL_XSPI_STATE_READY          0x02U
+#define HAL_XSPI_STATE_CMD_CFG        0x04U
+#define HAL_XSPI_STATE_BUSY_MEM_MAPPED 0x88U
+
+typedef struct __XSPI_HandleTypeDef
+{
+  XSPI_TypeDef        *Instance;
+  XSPI_InitTypeDef     Init;
+  uint8_t             *pBuffPtr;
+  __IO uint32_t        XferSize;
+  __IO uint32_t        XferCount;
+  DMA_HandleTypeDef   *hdmatx;
+  DMA_HandleTypeDef   *hdmarx;
+  __IO uint32_t        State;
+  __IO uint32_t        ErrorCode;
+  uint32_t             Timeout;
+#if (USE_HAL_XSPI_REGISTER_CALLBACKS == 1)
+  void (*MspInitCallback)(struct __XSPI_HandleTypeDef *hxspi);
+  void (*MspDeInitCallback)(struct __XSPI_HandleTypeDef *hxspi);
+#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS == 1) */
+} XSPI_HandleTypeDef;
+
+typedef void (*pXSPI_CallbackTypeDef)(XSPI_HandleTypeDef *hxspi);
+
+#define HAL_XSPI_FLAG_TC              (1UL << 1U)
+#define HAL_XSPI_FLAG_FT              (1UL << 2U)
+
+/* The FIFO of an indirect write fed through the data register is run by the flag reads */
+FlagStatus HOST_XspiGetFlag(XSPI_HandleTypeDef *hxspi, uint32_t Flag);
+void       HOST_XspiClearFlag(XSPI_HandleTypeDef *hxspi, uint32_t Flag);
+#define __HAL_XSPI_GET_FLAG(__HANDLE__, __FLAG__)   HOST_XspiGetFlag((__HANDLE__), (__FLAG__))
+#define __HAL_XSPI_CLEAR_FLAG(__HANDLE__, __FLAG__) HOST_XspiClearFlag((__HANDLE__), (__FLAG__))
+
+typedef enum
+{
+  HAL_XSPI_ERROR_CB_ID          = 0x00U,
+  HAL_XSPI_ABORT_CB_ID          = 0x01U,
+  HAL_XSPI_FIFO_THRESHOLD_CB_ID = 0x02U,
+  HAL_XSPI_CMD_CPLT_CB_ID       = 0x03U,
+  HAL_XSPI_RX_CPLT_CB_ID        = 0x04U,
+  HAL_XSPI_TX_CPLT_CB_ID        = 0x05U,
+  HAL_XSPI_RX_HALF_CPLT_CB_ID   = 0x06U,
+  HAL_XSPI_TX_HALF_CPLT_CB_ID   = 0x07U,
+  HAL_XSPI_STATUS_MATCH_CB_ID   = 0x08U,
+  HAL_XSPI_TIMEOUT_CB_ID        = 0x09U,
+  HAL_XSPI_MSP_INIT_CB_ID       = 0x0AU,
+  HAL_XSPI_MSP_DEINIT_CB_ID     = 0x0BU
+} HAL_XSPI_CallbackIDTypeDef;
+
+typedef struct
+{
+  uint32_t OperationType;
+  uint32_t IOSelect;
+  uint32_t Instruction;
+  uint32_t InstructionMode;
+  uint32_t InstructionWidth;
+  uint32_t InstructionDTRMode;
+  uint32_t Address;
+  uint32_t AddressMode;
+  uint32_t AddressWidth;
+  uint32_t AddressDTRMode;
+  uint32_t AlternateBytes;
+  uint32_t AlternateBytesMode;
+  uint32_t AlternateBytesWidth;
+  uint32_t AlternateBytesDTRMode;
+  uint32_t DataMode;
+  uint32_t DataLength;
+  uint32_t DataDTRMode;
+  uint32_t DummyCycles;
+  uint32_t DQSMode;
+  uint32_t SIOOMode;
+} XSPI_RegularCmdTypeDef;
+
+typedef struct
+{
+  uint32_t MatchValue;
+  uint32_t MatchMask;
+  uint32_t MatchMode;
+  uint32_t AutomaticStop;
+  uint32_t IntervalTime;
+} XSPI_AutoPollingTypeDef;
+
+typedef struct
+{
+  uint32_t TimeOutActivation;
+  uint32_t TimeoutPeriodClock;
+} XSPI_MemoryMappedTypeDef;
+
+typedef struct
+{
+  uint32_t Units;
+  uint32_t PhaseSel;
+} HAL_XSPI_DLYB_CfgTypeDef;
+
+#define HAL_XSPI_TIMEOUT_DEFAULT_VALUE    5000U
+
+#define HAL_XSPI_SINGLE_MEM               0U
+#define HAL_XSPI_MEMTYPE_MICRON           0U
+#define HAL_XSPI_MEMTYPE_MACRONIX         1U
+#define HAL_XSPI_FREERUNCLK_DISABLE       0U
+#define HAL_XSPI_CLOCK_MODE_0             0U
+#define HAL_XSPI_WRAP_NOT_SUPPORTED       0U
+#define HAL_XSPI_SAMPLE_SHIFT_NONE        0U
+#define HAL_XSPI_SAMPLE_SHIFT_HALFCYCLE   1U
+#define HAL_XSPI_DHQC_DISABLE             0U
+#define HAL_XSPI_DHQC_ENABLE              1U
+#define HAL_XSPI_CSSEL_NCS1               0U
+
+#define HAL_XSPI_OPTYPE_COMMON_CFG        0U
+#define HAL_XSPI_OPTYPE_READ_CFG          1U
+#define HAL_XSPI_OPTYPE_WRITE_CFG         2U
+#define HAL_XSPI_OPTYPE_WRAP_CFG          3U
+
+/* The modes of the phases are their number of lines */
+#define HAL_XSPI_INSTRUCTION_NONE         0U
+#define HAL_XSPI_INSTRUCTION_1_LINE       1U
+#define HAL_XSPI_INSTRUCTION_2_LINES      2U
+#define HAL_XSPI_INSTRUCTION_4_LINES      4U
+#define HAL_XSPI_INSTRUCTION_8_BITS       8U
+#define HAL_XSPI_INSTRUCTION_DTR_DISABLE  0U
+#define HAL_XSPI_ADDRESS_NONE             0U
+#define HAL_XSPI_ADDRESS_1_LINE           1U
+#define HAL_XSPI_ADDRESS_2_LINES          2U
+#define HAL_XSPI_ADDRESS_4_LINES          4U
+#define HAL_XSPI_ADDRESS_24_BITS          24U
+#define HAL_XSPI_ADDRESS_DTR_DISABLE      0U
+#define HAL_XSPI_ALT_BYTES_NONE           0U
+#define HAL_XSPI_ALT_BYTES_1_LINE         1U
+#define HAL_XSPI_ALT_BYTES_2_LINES        2U
+#define HAL_XSPI_ALT_BYTES_4_LINES        4U
+#define HAL_XSPI_ALT_BYTES_8_BITS         8U
+#define HAL_XSPI_ALT_BYTES_DTR_DISABLE    0U
+#define HAL_XSPI_DATA_NONE                0U
+#define HAL_XSPI_DATA_1_LINE              1U
+#define HAL_XSPI_DATA_2_LINES             2U
+#define HAL_XSPI_DATA_4_LINES             4U
+#define HAL_XSPI_DATA_DTR_DISABLE         0U
+#define HAL_XSPI_DQS_DISABLE              0U
+#define HAL_XSPI_SIOO_INST_EVERY_CMD      0U
+#define HAL_XSPI_SIOO_INST_ONLY_FIRST_CMD 1U
+
+#define HAL_XSPI_MATCH_MODE_AND           0U
+#define HAL_XSPI_AUTOMATIC_STOP_ENABLE    1U
+#define HAL_XSPI_TIMEOUT_COUNTER_DISABLE  0U
+#define HAL_XSPI_TIMEOUT_COUNTER_ENABLE   1U
+
+HAL_StatusTypeDef HAL_XSPI_Init(XSPI_HandleTypeDef *hxspi);
+HAL_StatusTypeDef HAL_XSPI_DeInit(XSPI_HandleTypeDef *hxspi);
+HAL_StatusTypeDef HAL_XSPI_Command(XSPI_HandleTypeDef *hxspi, const XSPI_RegularCmdTypeDef *pCmd, uint32_t Timeout);
+HAL_StatusTypeDef HAL_XSPI_Command_IT(XSPI_HandleTypeDef *hxspi, const XSPI_RegularCmdTypeDef *pCmd);
+HAL_StatusTypeDef HAL_XSPI_AutoPolling(XSPI_HandleTypeDef *hxspi, const XSPI_AutoPollingTypeDef *pCfg,
+                                       uint32_t Timeout);
+HAL_StatusTypeDef HAL_XSPI_AutoPolling_IT(XSPI_HandleTypeDef *hxspi, const XSPI_AutoPollingTypeDef *pCfg);
+HAL_StatusTypeDef HAL_XSPI_Transmit(XSPI_HandleTypeDef *hxspi, const uint8_t *pData, uint32_t Timeout);
+HAL_StatusTypeDef HAL_XSPI_Receive(XSPI_HandleTypeDef *hxspi, uint8_t *pData, uint32_t Timeout);
+HAL_StatusTypeDef HAL_XSPI_Transmit_IT(XSPI_HandleTypeDef *hxspi, const uint8_t *pData);
+HAL_StatusTypeDef HAL_XSPI_Receive_IT(XSPI_HandleTypeDef *hxspi, uint8_t *pData);
+HAL_StatusTypeDef HAL_XSPI_Transmit_DMA(XSPI_HandleTypeDef *hxspi, const uint8_t *pData);
+HAL_StatusTypeDef HAL_XSPI_Receive_DMA(XSPI_HandleTypeDef *hxspi, uint8_t *pData);
+HAL_StatusTypeDef HAL_XSPI_MemoryMapped(XSPI_HandleTypeDef *hxspi, const XSPI_MemoryMappedTypeDef *pCfg);
+HAL_StatusTypeDef HAL_XSPI_Abort(XSPI_HandleTypeDef *hxspi);
+HAL_StatusTypeDef HAL_XSPI_SetFifoThreshold(XSPI_HandleTypeDef *hxspi, uint32_t Threshold);
+uint32_t          HAL_XSPI_GetFifoThreshold(const XSPI_HandleTypeDef *hxspi);
+uint32_t          HAL_XSPI_GetState(const XSPI_HandleTypeDef *hxspi);
+void              HAL_XSPI_IRQHandler(XSPI_HandleTypeDef *hxspi);
+HAL_StatusTypeDef HAL_XSPI_RegisterCallback(XSPI_HandleTypeDef *hxspi, HAL_XSPI_CallbackIDTypeDef CallbackID,
+                                            pXSPI_CallbackTypeDef pCallback);
+HAL_StatusTypeDef HAL_XSPI_DLYB_SetConfig(XSPI_HandleTypeDef *hxspi, const HAL_XSPI_DLYB_CfgTypeDef *pDlyb);
+HAL_StatusTypeDef HAL_XSPI_DLYB_GetConfig(const XSPI_HandleTypeDef *hxspi, HAL_XSPI_DLYB_CfgTypeDef *pDlyb);
+HAL_StatusTypeDef HAL_XSPI_DLYB_GetClockPeriod(XSPI_HandleTypeDef *hxspi, HAL_XSPI_DLYB_CfgTypeDef *pDlyb);
+void HAL_XSPI_CmdCpltCallback(XSPI_HandleTypeDef *hxspi);
+void HAL_XSPI_RxCpltCallback(XSPI_HandleTypeDef *hxspi);
+void HAL_XSPI_TxCpltCallback(XSPI_HandleTypeDef *hxspi);
+void HAL_XSPI_StatusMatchCallback(XSPI_HandleTypeDef *hxspi);
+void HAL_XSPI_ErrorCallback(XSPI_HandleTypeDef *hxspi);
+
+/* CRC -----------------------------------------------------------------------*/
+typedef struct
+{
+  uint8_t  DefaultPolynomialUse;
+  uint8_t  DefaultInitValueUse;
+  uint32_t GeneratingPolynomial;
+  uint32_t CRCLength;
+  uint32_t InitValue;
+  uint32_t InputDataInversionMode;
+  uint32_t OutputDataInversionMode;
+} CRC_InitTypeDef;
+
+typedef struct
+{
+  CRC_TypeDef     *Instance;
+  CRC_InitTypeDef  Init;
+  uint32_t         InputDataFormat;
+  __IO uint32_t    State;
+} CRC_HandleTypeDef;
+
+#define DEFAULT_POLYNOMIAL_ENABLE         0U
+#define DEFAULT_POLYNOMIAL_DISABLE        1U
+#define DEFAULT_INIT_VALUE_ENABLE         0U
+#define DEFAULT_INIT_VALUE_DISABLE        1U
+#define DEFAULT_CRC32_POLY                0x04C11DB7U
+#define DEFAULT_CRC_INITVALUE             0xFFFFFFFFU
+#define CRC_POLYLENGTH_32B                0U
+#define CRC_INPUTDATA_INVERSION_NONE      0U
+#define CRC_INPUTDATA_INVERSION_BYTE      1U
+#define CRC_INPUTDATA_INVERSION_HALFWORD  2U
+#define CRC_INPUTDATA_INVERSION_WORD      3U
+#define CRC_OUTPUTDATA_INVERSION_DISABLE  0U
+#define CRC_OUTPUTDATA_INVERSION_ENABLE   1U
+#define CRC_INPUTDATA_FORMAT_BYTES        1U
+#define CRC_INPUTDATA_FORMAT_HALFWORDS    2U
+#define CRC_INPUTDATA_FORMAT_WORDS        3U
+
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *hcrc);
+HAL_StatusTypeDef HAL_CRC_DeInit(CRC_HandleTypeDef *hcrc);
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+HAL_StatusTypeDef HAL_CRCEx_Input_Data_Reverse(CRC_HandleTypeDef *hcrc, uint32_t InputReverseMode);
+
+/* ICACHE --------------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t BaseAddress;
+  uintptr_t RemapAddress;
+  uint32_t Size;
+  uint32_t TrafficRoute;
+  uint32_t OutputBurstType;
+} ICACHE_RegionConfigTypeDef;
+
+#define ICACHE_REGION_0                   0U
+#define ICACHE_REGIONSIZE_2MB             1U
+#define ICACHE_REGIONSIZE_4MB             2U
+#define ICACHE_MASTER2_PORT               1U
+#define ICACHE_OUTPUT_BURST_INCR          0U
+#define ICACHE_OUTPUT_BURST_WRAP          1U
+#define ICACHE_MONITOR_HIT_MISS           3U
+
+HAL_StatusTypeDef HAL_ICACHE_Enable(void);
+HAL_StatusTypeDef HAL_ICACHE_Disable(void);
+HAL_StatusTypeDef HAL_ICACHE_Invalidate(void);
+HAL_StatusTypeDef HAL_ICACHE_EnableRemapRegion(uint32_t Region, const ICACHE_RegionConfigTypeDef *pRegionConfig);
+HAL_StatusTypeDef HAL_ICACHE_DisableRemapRegion(uint32_t Region);
+HAL_StatusTypeDef HAL_ICACHE_Monitor_Start(uint32_t MonitorType);
+HAL_StatusTypeDef HAL_ICACHE_Monitor_Stop(uint32_t MonitorType);
+HAL_StatusTypeDef HAL_ICACHE_Monitor_Reset(uint32_t MonitorType);
+uint32_t HAL_ICACHE_Monitor_GetHitValue(void);
+uint32_t HAL_ICACHE_Monitor_GetMissValue(void);
+
+/* UART ----------------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t BaudRate;
+  uint32_t WordLength;
+  uint32_t StopBits;
+  uint32_t Parity;
+  uint32_t Mode;
+  uint32_t HwFlowCtl;
+  uint32_t OverSampling;
+} UART_InitTypeDef;
+
+typedef struct __UART_HandleTypeDef
+{
+  USART_TypeDef    *Instance;
+  UART_InitTypeDef  Init;
+} UART_HandleTypeDef;
+
+typedef void (*pUART_CallbackTypeDef)(UART_HandleTypeDef *huart);
+
+#define UART_WORDLENGTH_7B                0x10000000U
+#define UART_WORDLENGTH_8B                0x00000000U
+#define UART_WORDLENGTH_9B                0x00001000U
+#define UART_STOPBITS_1                   0x00000000U
+#define UART_STOPBITS_2                   0x00002000U
+#define UART_PARITY_NONE                  0x00000000U
+#define UART_PARITY_EVEN                  0x00000400U
+#define UART_PARITY_ODD                   0x00000600U
+#define UART_HWCONTROL_NONE               0x00000000U
+#define UART_HWCONTROL_RTS                0x00000100U
+#define UART_HWCONTROL_CTS                0x00000200U
+#define UART_HWCONTROL_RTS_CTS            0x00000300U
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size,
+                                    uint32_t Timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32WBAXX_HAL_H */
@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file    stm32wbaxx_nucleo_conf.h
+  * @author  MCD Application Team
+  * @brief   Host build of the XSPI BSP: configuration file of the board.
+  *          The XSPI options are the ones of stm32wbaxx_nucleo_conf_template.h,
+  *          and can be set from the make command line, e.g.
+  *          make FEATURES="USE_BSP_XSPI_READ_CACHE=1U USE_BSP_XSPI_STATS=1U".
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32WBAXX_NUCLEO_CONF_H
+#define STM32WBAXX_NUCLEO_CONF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32wbaxx_hal.h"
+
+/* Usage of nucleo board */
+#define USE_NUCLEO_64      1U
+
+/* Usage of COM feature: the COM port output is a host file */
+#define USE_BSP_COM_FEATURE 1U
+#define USE_COM_LOG         0U
+
+/* Button interrupt priorities */
+#define BSP_B1_IT_PRIORITY 0x0FUL  /* Default is lowest priority level */
+#define BSP_B2_IT_PRIORITY 0x0FUL  /* Default is lowest priority level */
+#define BSP_B3_IT_PRIORITY 0x0FUL  /* Default is lowest priority level */
+
+/* XSPI features: interrupts are not simulated, USE_BSP_XSPI_IT_FEATURE and
+   USE_BSP_XSPI_DMA_FEATURE are not supported by the host build */
+#ifndef USE_BSP_XSPI_READ_CACHE
+#define USE_BSP_XSPI_READ_CACHE 0U
+#endif /* USE_BSP_XSPI_READ_CACHE */
+#ifndef USE_BSP_XSPI_WRITE_COMBINE
+#define USE_BSP_XSPI_WRITE_COMBINE 0U
+#endif /* USE_BSP_XSPI_WRITE_COMBINE */
+#ifndef USE_BSP_XSPI_BLANK_CHECK
+#define USE_BSP_XSPI_BLANK_CHECK 0U
+#endif /* USE_BSP_XSPI_BLANK_CHECK */
+#ifndef USE_BSP_XSPI_WRITE_VERIFY
+#define USE_BSP_XSPI_WRITE_VERIFY 0U
+#endif /* USE_BSP_XSPI_WRITE_VERIFY */
+#ifndef USE_BSP_XSPI_SCHEDULER
+#define USE_BSP_XSPI_SCHEDULER 0U
+#endif /* USE_BSP_XSPI_SCHEDULER */
+#ifndef USE_BSP_XSPI_BENCHMARK
+#define USE_BSP_XSPI_BENCHMARK 1U
+#endif /* USE_BSP_XSPI_BENCHMARK */
+#ifndef USE_BSP_XSPI_CALIBRATION
+#define USE_BSP_XSPI_CALIBRATION 0U
+#endif /* USE_BSP_XSPI_CALIBRATION */
+#ifndef USE_BSP_XSPI_MMP_ARBITRATION
+#define USE_BSP_XSPI_MMP_ARBITRATION 0U
+#endif /* USE_BSP_XSPI_MMP_ARBITRATION */
+#ifndef USE_BSP_XSPI_AUTO_POWER_DOWN
+#define USE_BSP_XSPI_AUTO_POWER_DOWN 0U
+#endif /* USE_BSP_XSPI_AUTO_POWER_DOWN */
+#ifndef USE_BSP_XSPI_WARM_INIT
+#define USE_BSP_XSPI_WARM_INIT 0U
+#endif /* USE_BSP_XSPI_WARM_INIT */
+#ifndef USE_BSP_XSPI_ICACHE
+#define USE_BSP_XSPI_ICACHE 0U
+#endif /* USE_BSP_XSPI_ICACHE */
+#ifndef USE_BSP_XSPI_VECTOR_IO
+#define USE_BSP_XSPI_VECTOR_IO 0U
+#endif /* USE_BSP_XSPI_VECTOR_IO */
+#ifndef USE_BSP_XSPI_STREAM
+#define USE_BSP_XSPI_STREAM 0U
+#endif /* USE_BSP_XSPI_STREAM */
+#ifndef USE_BSP_XSPI_CRC
+#define USE_BSP_XSPI_CRC 0U
+#endif /* USE_BSP_XSPI_CRC */
+#ifndef USE_BSP_XSPI_STATS
+#define USE_BSP_XSPI_STATS 0U
+#endif /* USE_BSP_XSPI_STATS */
+#ifndef USE_BSP_XSPI_TRACE
+#define USE_BSP_XSPI_TRACE 0U
+#endif /* USE_BSP_XSPI_TRACE */
+
+#define USE_BSP_XSPI_IT_FEATURE 0U
+#define USE_BSP_XSPI_DMA_FEATURE 0U
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32WBAXX_NUCLEO_CONF_H */
@@ -0,0 +1,749 @@
+/**
+  ******************************************************************************
+  * @file    flash_model.c
+  * @author  MCD Application Team
+  * @brief   Host build of the XSPI BSP: model of the MX25R3235F memory.
+  *          The memory state is evaluated lazily: each frame first completes the
+  *          operations whose duration has elapsed at the frame time. Commands the
+  *          real memory would ignore are ignored too, and counted as violations.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "flash_model.h"
+
+/* Private define ------------------------------------------------------------*/
+#define FLASH_MODEL_PAGE_SIZE           0x100U
+#define FLASH_MODEL_NS_PER_US           1000U
+
+/* Commands */
+#define FLASH_MODEL_CMD_READ            0x03U
+#define FLASH_MODEL_CMD_FAST_READ       0x0BU
+#define FLASH_MODEL_CMD_DREAD           0x3BU
+#define FLASH_MODEL_CMD_2READ           0xBBU
+#define FLASH_MODEL_CMD_QREAD           0x6BU
+#define FLASH_MODEL_CMD_4READ           0xEBU
+#define FLASH_MODEL_CMD_PP              0x02U
+#define FLASH_MODEL_CMD_4PP             0x38U
+#define FLASH_MODEL_CMD_SE              0x20U
+#define FLASH_MODEL_CMD_BE32K           0x52U
+#define FLASH_MODEL_CMD_BE              0xD8U
+#define FLASH_MODEL_CMD_CE              0x60U
+#define FLASH_MODEL_CMD_CE_ALT          0xC7U
+#define FLASH_MODEL_CMD_WREN            0x06U
+#define FLASH_MODEL_CMD_WRDI            0x04U
+#define FLASH_MODEL_CMD_RDSR            0x05U
+#define FLASH_MODEL_CMD_RDCR            0x15U
+#define FLASH_MODEL_CMD_WRSR            0x01U
+#define FLASH_MODEL_CMD_RDSCUR          0x2BU
+#define FLASH_MODEL_CMD_SUSPEND         0xB0U
+#define FLASH_MODEL_CMD_SUSPEND_ALT     0x75U
+#define FLASH_MODEL_CMD_RESUME          0x30U
+#define FLASH_MODEL_CMD_RESUME_ALT      0x7AU
+#define FLASH_MODEL_CMD_DP              0xB9U
+#define FLASH_MODEL_CMD_NOP             0x00U
+#define FLASH_MODEL_CMD_RDID            0x9FU
+#define FLASH_MODEL_CMD_RSTEN           0x66U
+#define FLASH_MODEL_CMD_RST             0x99U
+
+/* Registers */
+#define FLASH_MODEL_SR_WIP              0x01U
+#define FLASH_MODEL_SR_WEL              0x02U
+#define FLASH_MODEL_SR_NV_MASK          0xFCU      /* BP, QE and SRWD bits */
+#define FLASH_MODEL_SR_QE               0x40U
+#define FLASH_MODEL_SECR_PSB            0x04U
+#define FLASH_MODEL_SECR_ESB            0x08U
+#define FLASH_MODEL_MODE_PE_EXIT        0xFFU
+
+/* Operations setting the write in progress bit */
+#define FLASH_MODEL_OP_NONE             0U
+#define FLASH_MODEL_OP_PROGRAM          1U
+#define FLASH_MODEL_OP_ERASE            2U
+#define FLASH_MODEL_OP_WRSR             3U
+#define FLASH_MODEL_OP_SUSPEND          4U         /* Suspend latency */
+#define FLASH_MODEL_OP_RESET            5U         /* Reset recovery */
+
+/* Power states */
+#define FLASH_MODEL_POWER_ACTIVE        0U
+#define FLASH_MODEL_POWER_ENTERING      1U         /* tDP after the DP command */
+#define FLASH_MODEL_POWER_DOWN          2U
+#define FLASH_MODEL_POWER_WAKING        3U         /* tRDP after the chip select pulse */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint8_t             *pArray;
+  const char          *pImagePath;
+  FLASH_MODEL_Timing_t Timing;
+  uint8_t              Status;                  /* Non-volatile bits of the status register */
+  uint8_t              Config[2];
+  uint8_t              Security;
+  uint32_t             WriteEnable;
+  uint32_t             ResetEnable;
+  uint32_t             PerformanceEnhance;
+  uint32_t             Operation;               /* FLASH_MODEL_OP_xxx with WIP set */
+  uint64_t             BusyStart;
+  uint64_t             BusyEnd;
+  uint32_t             SuspendedOperation;      /* Program or erase suspended, or none */
+  uint32_t             SuspendedAddress;        /* Start of the suspended erase */
+  uint32_t             SuspendedSize;           /* Size of the suspended erase */
+  uint64_t             SuspendedRemaining;      /* Time left to the suspended operation */
+  uint32_t             EraseAddress;            /* Start of the erase in progress */
+  uint32_t             EraseSize;               /* Size of the erase in progress */
+  uint32_t             PowerState;
+  uint64_t             PowerEnd;
+  uint32_t             EraseCount[FLASH_MODEL_SECTORS_NUMBER];
+  FLASH_MODEL_Stats_t  Stats;
+} FLASH_MODEL_State_t;
+
+/* Private variables ---------------------------------------------------------*/
+static FLASH_MODEL_State_t Model;
+
+/* Private function prototypes -----------------------------------------------*/
+static void     FLASH_MODEL_Update(uint64_t Now);
+static uint32_t FLASH_MODEL_IsAllowed(uint32_t Instruction, uint32_t Address);
+static void     FLASH_MODEL_Read(const FLASH_MODEL_Frame_t *pFrame, uint32_t Instruction, uint8_t *pData,
+                                 uint32_t Size);
+static void     FLASH_MODEL_Program(uint64_t Now, uint32_t Address, const uint8_t *pData, uint32_t Size);
+static void     FLASH_MODEL_Erase(uint64_t Now, uint32_t Address, uint32_t Size, uint32_t Duration);
+static void     FLASH_MODEL_Busy(uint64_t Now, uint32_t Operation, uint64_t Duration);
+static uint8_t  FLASH_MODEL_StatusRegister(void);
+static uint32_t FLASH_MODEL_IsQuad(const FLASH_MODEL_Frame_t *pFrame);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Returns the typical durations of the datasheet.
+  * @param  pTiming Pointer to the durations
+  * @retval None
+  */
+void FLASH_MODEL_GetDefaultTiming(FLASH_MODEL_Timing_t *pTiming)
+{
+  pTiming->PageProgram    = 850U;
+  pTiming->SectorErase    = 40000U;
+  pTiming->BlockErase32K  = 200000U;
+  pTiming->BlockErase64K  = 400000U;
+  pTiming->ChipErase      = 22000000U;
+  pTiming->WriteStatus    = 10000U;
+  pTiming->SuspendLatency = 20U;
+  pTiming->PowerDownEntry = 10U;
+  pTiming->PowerDownExit  = 35U;
+  pTiming->ResetReady     = 40U;
+  pTiming->ResetReadyBusy = 12000U;
+}
+
+/**
+  * @brief  Initializes the model: blank array, or content of the image file if it exists.
+  * @param  pImagePath Image file, saved by FLASH_MODEL_DeInit(), NULL for a RAM only array
+  * @param  pTiming    Durations, NULL for the datasheet ones
+  * @retval FLASH_MODEL_OK or FLASH_MODEL_ERROR
+  */
+int32_t FLASH_MODEL_Init(const char *pImagePath, const FLASH_MODEL_Timing_t *pTiming)
+{
+  FILE *file;
+
+  (void)memset(&Model, 0, sizeof(Model));
+
+  Model.pArray = malloc(FLASH_MODEL_SIZE);
+  if (Model.pArray == NULL)
+  {
+    return FLASH_MODEL_ERROR;
+  }
+  (void)memset(Model.pArray, 0xFF, FLASH_MODEL_SIZE);
+
+  if (pTiming != NULL)
+  {
+    Model.Timing = *pTiming;
+  }
+  else
+  {
+    FLASH_MODEL_GetDefaultTiming(&Model.Timing);
+  }
+
+  Model.pImagePath = pImagePath;
+  if (pImagePath != NULL)
+  {
+    file = fopen(pImagePath, "rb");
+    if (file != NULL)
+    {
+      if (fread(Model.pArray, 1U, FLASH_MODEL_SIZE, file) != FLASH_MODEL_SIZE)
+      {
+        (void)fclose(file);
+        return FLASH_MODEL_ERROR;
+      }
+      (void)fclose(file);
+    }
+  }
+
+  return FLASH_MODEL_OK;
+}
+
+/**
+  * @brief  De-initializes the model, saving the array to the image file if any.
+  * @retval FLASH_MODEL_OK or FLASH_MODEL_ERROR
+  */
+int32_t FLASH_MODEL_DeInit(void)
+{
+  int32_t ret = FLASH_MODEL_OK;
+  FILE *file;
+
+  if ((Model.pImagePath != NULL) && (Model.pArray != NULL))
+  {
+    file = fopen(Model.pImagePath, "wb");
+    if ((file == NULL) || (fwrite(Model.pArray, 1U, FLASH_MODEL_SIZE, file) != FLASH_MODEL_SIZE))
+    {
+      ret = FLASH_MODEL_ERROR;
+    }
+    if (file != NULL)
+    {
+      (void)fclose(file);
+    }
+  }
+
+  free(Model.pArray);
+  Model.pArray = NULL;
+
+  return ret;
+}
+
+/**
+  * @brief  Runs a command frame ending at a given time.
+  * @param  Now    Time of the end of the frame in ns
+  * @param  pFrame Command frame
+  * @param  pData  Data sent to the memory, or filled with the data received from it
+  * @param  Size   Data size
+  * @param  Write  1 if the data is sent to the memory, 0 if it is received from it
+  * @retval None
+  */
+void FLASH_MODEL_Transfer(uint64_t Now, const FLASH_MODEL_Frame_t *pFrame, uint8_t *pData, uint32_t Size,
+                          uint32_t Write)
+{
+  uint32_t instruction = pFrame->Instruction & 0xFFU;
+  uint32_t reset_enable = Model.ResetEnable;
+  uint32_t index;
+  uint8_t reg;
+
+  FLASH_MODEL_Update(Now);
+  Model.Stats.Frames++;
+  Model.ResetEnable = 0U;
+
+  /* Data not driven by the memory reads as all ones */
+  if ((Write == 0U) && (pData != NULL))
+  {
+    (void)memset(pData, 0xFF, Size);
+  }
+
+  /* Any chip select pulse starts the exit of the deep power-down */
+  if (Model.PowerState == FLASH_MODEL_POWER_DOWN)
+  {
+    Model.PowerState = FLASH_MODEL_POWER_WAKING;
+    Model.PowerEnd   = Now + ((uint64_t)Model.Timing.PowerDownExit * FLASH_MODEL_NS_PER_US);
+    return;
+  }
+  if (Model.PowerState != FLASH_MODEL_POWER_ACTIVE)
+  {
+    Model.Stats.Violations++;
+    return;
+  }
+
+  /* No instruction: 4READ in performance enhance mode, else the mode bits reset sequence */
+  if (pFrame->InstructionLines == 0U)
+  {
+    if (Model.PerformanceEnhance != 0U)
+    {
+      instruction = FLASH_MODEL_CMD_4READ;
+    }
+    else
+    {
+      if (((pFrame->AlternateBytes & 0xFFU) != FLASH_MODEL_MODE_PE_EXIT) || (pFrame->AlternateBytesLines == 0U))
+      {
+        Model.Stats.Violations++;
+      }
+      return;
+    }
+  }
+
+  if (FLASH_MODEL_IsAllowed(instruction, pFrame->Address) == 0U)
+  {
+    Model.Stats.Violations++;
+    return;
+  }
+
+  switch (instruction)
+  {
+    case FLASH_MODEL_CMD_READ :
+    case FLASH_MODEL_CMD_FAST_READ :
+    case FLASH_MODEL_CMD_DREAD :
+    case FLASH_MODEL_CMD_2READ :
+    case FLASH_MODEL_CMD_QREAD :
+    case FLASH_MODEL_CMD_4READ :
+      if ((Write == 0U) && (pData != NULL))
+      {
+        FLASH_MODEL_Read(pFrame, instruction, pData, Size);
+      }
+      break;
+
+    case FLASH_MODEL_CMD_PP :
+    case FLASH_MODEL_CMD_4PP :
+      if ((Model.WriteEnable == 0U) || (Write == 0U) || (Size == 0U) ||
+          ((instruction == FLASH_MODEL_CMD_4PP) && (FLASH_MODEL_IsQuad(pFrame) == 0U)))
+      {
+        Model.Stats.Violations++;
+      }
+      else
+      {
+        FLASH_MODEL_Program(Now, pFrame->Address, pData, Size);
+      }
+      break;
+
+    case FLASH_MODEL_CMD_SE :
+      FLASH_MODEL_Erase(Now, pFrame->Address, 0x1000U, Model.Timing.SectorErase);
+      break;
+
+    case FLASH_MODEL_CMD_BE32K :
+      FLASH_MODEL_Erase(Now, pFrame->Address, 0x8000U, Model.Timing.BlockErase32K);
+      break;
+
+    case FLASH_MODEL_CMD_BE :
+      FLASH_MODEL_Erase(Now, pFrame->Address, 0x10000U, Model.Timing.BlockErase64K);
+      break;
+
+    case FLASH_MODEL_CMD_CE :
+    case FLASH_MODEL_CMD_CE_ALT :
+      FLASH_MODEL_Erase(Now, 0U, FLASH_MODEL_SIZE, Model.Timing.ChipErase);
+      break;
+
+    case FLASH_MODEL_CMD_WREN :
+      Model.WriteEnable = 1U;
+      break;
+
+    case FLASH_MODEL_CMD_WRDI :
+      Model.WriteEnable = 0U;
+      break;
+
+    case FLASH_MODEL_CMD_RDSR :
+      reg = FLASH_MODEL_StatusRegister();
+      Model.Stats.StatusReads++;
+      if ((reg & FLASH_MODEL_SR_WIP) != 0U)
+      {
+        Model.Stats.BusyStatusReads++;
+      }
+      for (index = 0U; (pData != NULL) && (Write == 0U) && (index < Size); index++)
+      {
+        pData[index] = reg;
+      }
+      break;
+
+    case FLASH_MODEL_CMD_RDCR :
+      for (index = 0U; (pData != NULL) && (Write == 0U) && (index < Size); index++)
+      {
+        pData[index] = Model.Config[index % 2U];
+      }
+      break;
+
+    case FLASH_MODEL_CMD_RDSCUR :
+      for (index = 0U; (pData != NULL) && (Write == 0U) && (index < Size); index++)
+      {
+        pData[index] = Model.Security;
+      }
+      break;
+
+    case FLASH_MODEL_CMD_RDID :
+      for (index = 0U; (pData != NULL) && (Write == 0U) && (index < Size); index++)
+      {
+        pData[index] = (index == 0U) ? 0xC2U : ((index == 1U) ? 0x28U : ((index == 2U) ? 0x16U : 0xFFU));
+      }
+      break;
+
+    case FLASH_MODEL_CMD_WRSR :
+      if ((Model.WriteEnable == 0U) || (Write == 0U) || (Size == 0U))
+      {
+        Model.Stats.Violations++;
+      }
+      else
+      {
+        Model.Status = pData[0] & FLASH_MODEL_SR_NV_MASK;
+        if (Size > 1U)
+        {
+          Model.Config[0] = pData[1];
+        }
+        if (Size > 2U)
+        {
+          Model.Config[1] = pData[2];
+        }
+        FLASH_MODEL_Busy(Now, FLASH_MODEL_OP_WRSR, (uint64_t)Model.Timing.WriteStatus * FLASH_MODEL_NS_PER_US);
+      }
+      break;
+
+    case FLASH_MODEL_CMD_SUSPEND :
+    case FLASH_MODEL_CMD_SUSPEND_ALT :
+      /* Ignored when no program or erase is in progress */
+      if ((Model.Operation == FLASH_MODEL_OP_PROGRAM) || (Model.Operation == FLASH_MODEL_OP_ERASE))
+      {
+        Model.SuspendedOperation = Model.Operation;
+        Model.SuspendedAddress   = Model.EraseAddress;
+        Model.SuspendedSize      = (Model.Operation == FLASH_MODEL_OP_ERASE) ? Model.EraseSize : 0U;
+        Model.SuspendedRemaining = Model.BusyEnd - Now;
+        Model.Stats.BusyTime    += Now - Model.BusyStart;
+        Model.Stats.Suspends++;
+        FLASH_MODEL_Busy(Now, FLASH_MODEL_OP_SUSPEND, (uint64_t)Model.Timing.SuspendLatency * FLASH_MODEL_NS_PER_US);
+      }
+      break;
+
+    case FLASH_MODEL_CMD_RESUME :
+    case FLASH_MODEL_CMD_RESUME_ALT :
+      if (Model.SuspendedOperation != FLASH_MODEL_OP_NONE)
+      {
+        Model.EraseAddress = Model.SuspendedAddress;
+        Model.EraseSize    = Model.SuspendedSize;
+        Model.Security    &= (uint8_t)~(FLASH_MODEL_SECR_PSB | FLASH_MODEL_SECR_ESB);
+        FLASH_MODEL_Busy(Now, Model.SuspendedOperation, Model.SuspendedRemaining);
+        Model.SuspendedOperation = FLASH_MODEL_OP_NONE;
+        Model.Stats.Resumes++;
+      }
+      break;
+
+    case FLASH_MODEL_CMD_DP :
+      Model.PowerState = FLASH_MODEL_POWER_ENTERING;
+      Model.PowerEnd   = Now + ((uint64_t)Model.Timing.PowerDownEntry * FLASH_MODEL_NS_PER_US);
+      Model.Stats.PowerDowns++;
+      break;
+
+    case FLASH_MODEL_CMD_RSTEN :
+      Model.ResetEnable = 1U;
+      break;
+
+    case FLASH_MODEL_CMD_RST :
+      if (reset_enable != 0U)
+      {
+        /* The reset aborts the operation in progress, an erase taking longer to recover */
+        if ((Model.Operation != FLASH_MODEL_OP_NONE) && (Model.Operation != FLASH_MODEL_OP_RESET))
+        {
+          Model.Stats.BusyTime += Now - Model.BusyStart;
+        }
+        FLASH_MODEL_Busy(Now, FLASH_MODEL_OP_RESET,
+                         (uint64_t)(((Model.Operation == FLASH_MODEL_OP_ERASE) ||
+                                     (Model.SuspendedOperation == FLASH_MODEL_OP_ERASE)) ?
+                                    Model.Timing.ResetReadyBusy : Model.Timing.ResetReady) * FLASH_MODEL_NS_PER_US);
+        Model.WriteEnable        = 0U;
+        Model.PerformanceEnhance = 0U;
+        Model.SuspendedOperation = FLASH_MODEL_OP_NONE;
+        Model.Security          &= (uint8_t)~(FLASH_MODEL_SECR_PSB | FLASH_MODEL_SECR_ESB);
+        Model.Stats.Resets++;
+      }
+      break;
+
+    case FLASH_MODEL_CMD_NOP :
+      break;
+
+    default :
+      Model.Stats.Violations++;
+      break;
+  }
+}
+
+/**
+  * @brief  Enables the memory-mapped mode with its read frame at a given time. The
+  *         memory-mapped reads are done directly in the array, not timed.
+  * @param  Now    Time in ns
+  * @param  pFrame Read frame of the memory-mapped mode
+  * @retval None
+  */
+void FLASH_MODEL_MemoryMapped(uint64_t Now, const FLASH_MODEL_Frame_t *pFrame)
+{
+  FLASH_MODEL_Update(Now);
+
+  if ((Model.PowerState != FLASH_MODEL_POWER_ACTIVE) || (Model.Operation != FLASH_MODEL_OP_NONE) ||
+      ((pFrame->InstructionLines == 0U) && (Model.PerformanceEnhance == 0U)))
+  {
+    Model.Stats.Violations++;
+  }
+  else if (((pFrame->Instruction & 0xFFU) == FLASH_MODEL_CMD_4READ) || (pFrame->InstructionLines == 0U))
+  {
+    /* The first line fill sets the performance enhance mode of the next ones */
+    Model.PerformanceEnhance = (((pFrame->AlternateBytes >> 4) & 0x0FU) != (pFrame->AlternateBytes & 0x0FU)) ?
+                               1U : 0U;
+  }
+  else
+  {
+    /* Read command without mode bits */
+  }
+}
+
+/**
+  * @brief  Returns the array, accessed directly by the memory-mapped reads.
+  * @retval Pointer to the array
+  */
+uint8_t *FLASH_MODEL_GetArray(void)
+{
+  return Model.pArray;
+}
+
+/**
+  * @brief  Returns the statistics at a given time.
+  * @param  Now    Time in ns
+  * @param  pStats Pointer to the statistics
+  * @retval None
+  */
+void FLASH_MODEL_GetStats(uint64_t Now, FLASH_MODEL_Stats_t *pStats)
+{
+  FLASH_MODEL_Update(Now);
+  *pStats = Model.Stats;
+}
+
+/**
+  * @brief  Resets the statistics, except the ignored commands count. The erase counters
+  *         are not reset.
+  * @retval None
+  */
+void FLASH_MODEL_ResetStats(void)
+{
+  uint32_t violations = Model.Stats.Violations;
+
+  (void)memset(&Model.Stats, 0, sizeof(Model.Stats));
+  Model.Stats.Violations = violations;
+}
+
+/**
+  * @brief  Returns the erase count of a 4KB sector.
+  * @param  Sector Sector number
+  * @retval Number of erases of the sector
+  */
+uint32_t FLASH_MODEL_GetEraseCount(uint32_t Sector)
+{
+  return (Sector < FLASH_MODEL_SECTORS_NUMBER) ? Model.EraseCount[Sector] : 0U;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Completes the operations ended at a given time.
+  * @param  Now Time in ns
+  * @retval None
+  */
+static void FLASH_MODEL_Update(uint64_t Now)
+{
+  if ((Model.Operation != FLASH_MODEL_OP_NONE) && (Now >= Model.BusyEnd))
+  {
+    if (Model.Operation == FLASH_MODEL_OP_SUSPEND)
+    {
+      /* Suspended: ready, with the write enable latch cleared */
+      Model.Security |= (Model.SuspendedOperation == FLASH_MODEL_OP_ERASE) ? FLASH_MODEL_SECR_ESB :
+                        FLASH_MODEL_SECR_PSB;
+    }
+    else if (Model.Operation != FLASH_MODEL_OP_RESET)
+    {
+      Model.Stats.BusyTime += Model.BusyEnd - Model.BusyStart;
+    }
+    else
+    {
+      /* Reset recovery done */
+    }
+    Model.WriteEnable = 0U;
+    Model.Operation   = FLASH_MODEL_OP_NONE;
+  }
+
+  if ((Model.PowerState == FLASH_MODEL_POWER_ENTERING) && (Now >= Model.PowerEnd))
+  {
+    Model.PowerState = FLASH_MODEL_POWER_DOWN;
+  }
+  else if ((Model.PowerState == FLASH_MODEL_POWER_WAKING) && (Now >= Model.PowerEnd))
+  {
+    Model.PowerState = FLASH_MODEL_POWER_ACTIVE;
+  }
+  else
+  {
+    /* No power state change */
+  }
+}
+
+/**
+  * @brief  Checks if a command is accepted in the current state of the memory: only
+  *         the status reads, the suspend and the reset while WIP is set, and no
+  *         erase, status write, deep power-down or program of a suspended
+  *         operation or of the erasing block while suspended.
+  * @param  Instruction Command opcode
+  * @param  Address     Command address
+  * @retval 1 if the command is accepted, 0 otherwise
+  */
+static uint32_t FLASH_MODEL_IsAllowed(uint32_t Instruction, uint32_t Address)
+{
+  uint32_t allowed = 1U;
+
+  if (Model.Operation != FLASH_MODEL_OP_NONE)
+  {
+    allowed = ((Instruction == FLASH_MODEL_CMD_RDSR) || (Instruction == FLASH_MODEL_CMD_RDSCUR) ||
+               (Instruction == FLASH_MODEL_CMD_SUSPEND) || (Instruction == FLASH_MODEL_CMD_SUSPEND_ALT) ||
+               (Instruction == FLASH_MODEL_CMD_RSTEN) || (Instruction == FLASH_MODEL_CMD_RST)) ? 1U : 0U;
+  }
+  else if (Model.SuspendedOperation != FLASH_MODEL_OP_NONE)
+  {
+    switch (Instruction)
+    {
+      case FLASH_MODEL_CMD_SE :
+      case FLASH_MODEL_CMD_BE32K :
+      case FLASH_MODEL_CMD_BE :
+      case FLASH_MODEL_CMD_CE :
+      case FLASH_MODEL_CMD_CE_ALT :
+      case FLASH_MODEL_CMD_WRSR :
+      case FLASH_MODEL_CMD_DP :
+        allowed = 0U;
+        break;
+
+      case FLASH_MODEL_CMD_PP :
+      case FLASH_MODEL_CMD_4PP :
+        allowed = ((Model.SuspendedOperation == FLASH_MODEL_OP_ERASE) &&
+                   (((Address % FLASH_MODEL_SIZE) < Model.SuspendedAddress) ||
+                    ((Address % FLASH_MODEL_SIZE) >= (Model.SuspendedAddress + Model.SuspendedSize)))) ? 1U : 0U;
+        break;
+
+      default :
+        break;
+    }
+  }
+  else
+  {
+    /* Ready */
+  }
+
+  return allowed;
+}
+
+/**
+  * @brief  Reads the array, updating the performance enhance mode of 4READ.
+  * @param  pFrame      Command frame
+  * @param  Instruction Read command opcode
+  * @param  pData       Pointer to the data
+  * @param  Size        Data size
+  * @retval None
+  */
+static void FLASH_MODEL_Read(const FLASH_MODEL_Frame_t *pFrame, uint32_t Instruction, uint8_t *pData,
+                             uint32_t Size)
+{
+  uint32_t index;
+  uint32_t address = pFrame->Address % FLASH_MODEL_SIZE;
+
+  /* The quad commands need the QE bit */
+  if (((Instruction == FLASH_MODEL_CMD_QREAD) || (Instruction == FLASH_MODEL_CMD_4READ)) &&
+      (FLASH_MODEL_IsQuad(pFrame) == 0U))
+  {
+    Model.Stats.Violations++;
+    return;
+  }
+
+  if (Instruction == FLASH_MODEL_CMD_4READ)
+  {
+    Model.PerformanceEnhance = (((pFrame->AlternateBytes >> 4) & 0x0FU) != (pFrame->AlternateBytes & 0x0FU)) ?
+                               1U : 0U;
+  }
+
+  for (index = 0U; index < Size; index++)
+  {
+    pData[index] = Model.pArray[(address + index) % FLASH_MODEL_SIZE];
+  }
+
+  Model.Stats.Reads++;
+  Model.Stats.ReadBytes += Size;
+}
+
+/**
+  * @brief  Programs a page: bits can only be cleared, the address wraps in the page.
+  * @param  Now     Time in ns
+  * @param  Address Program address
+  * @param  pData   Data to program
+  * @param  Size    Data size
+  * @retval None
+  */
+static void FLASH_MODEL_Program(uint64_t Now, uint32_t Address, const uint8_t *pData, uint32_t Size)
+{
+  uint32_t page = (Address % FLASH_MODEL_SIZE) & ~(FLASH_MODEL_PAGE_SIZE - 1U);
+  uint32_t index;
+
+  for (index = 0U; index < Size; index++)
+  {
+    Model.pArray[page + ((Address + index) % FLASH_MODEL_PAGE_SIZE)] &= pData[index];
+  }
+
+  Model.EraseAddress = page;
+  Model.EraseSize    = 0U;
+  Model.Stats.Programs++;
+  Model.Stats.ProgramBytes += Size;
+  FLASH_MODEL_Busy(Now, FLASH_MODEL_OP_PROGRAM, (uint64_t)Model.Timing.PageProgram * FLASH_MODEL_NS_PER_US);
+}
+
+/**
+  * @brief  Erases the block holding an address.
+  * @param  Now      Time in ns
+  * @param  Address  Address in the block
+  * @param  Size     Block size
+  * @param  Duration Erase duration in us
+  * @retval None
+  */
+static void FLASH_MODEL_Erase(uint64_t Now, uint32_t Address, uint32_t Size, uint32_t Duration)
+{
+  uint32_t start = (Address % FLASH_MODEL_SIZE) & ~(Size - 1U);
+  uint32_t sector;
+
+  if (Model.WriteEnable == 0U)
+  {
+    Model.Stats.Violations++;
+    return;
+  }
+
+  (void)memset(&Model.pArray[start], 0xFF, Size);
+  for (sector = start / FLASH_MODEL_SECTOR_SIZE; sector < ((start + Size) / FLASH_MODEL_SECTOR_SIZE); sector++)
+  {
+    Model.EraseCount[sector]++;
+  }
+
+  Model.EraseAddress = start;
+  Model.EraseSize    = Size;
+  Model.Stats.Erases++;
+  FLASH_MODEL_Busy(Now, FLASH_MODEL_OP_ERASE, (uint64_t)Duration * FLASH_MODEL_NS_PER_US);
+}
+
+/**
+  * @brief  Sets the write in progress bit for a duration.
+  * @param  Now       Time in ns
+  * @param  Operation Operation in progress
+  * @param  Duration  Duration in ns
+  * @retval None
+  */
+static void FLASH_MODEL_Busy(uint64_t Now, uint32_t Operation, uint64_t Duration)
+{
+  Model.Operation = Operation;
+  Model.BusyStart = Now;
+  Model.BusyEnd   = Now + Duration;
+}
+
+/**
+  * @brief  Returns the value of the status register.
+  * @retval Status register
+  */
+static uint8_t FLASH_MODEL_StatusRegister(void)
+{
+  return (uint8_t)(Model.Status | ((Model.WriteEnable != 0U) ? FLASH_MODEL_SR_WEL : 0U) |
+                   ((Model.Operation != FLASH_MODEL_OP_NONE) ? FLASH_MODEL_SR_WIP : 0U));
+}
+
+/**
+  * @brief  Checks that a frame on more than one line is allowed by the QE bit.
+  * @param  pFrame Command frame
+  * @retval 1 if allowed, 0 otherwise
+  */
+static uint32_t FLASH_MODEL_IsQuad(const FLASH_MODEL_Frame_t *pFrame)
+{
+  return (((Model.Status & FLASH_MODEL_SR_QE) != 0U) || ((pFrame->DataLines < 4U) &&
+                                                           (pFrame->AddressLines < 4U))) ? 1U : 0U;
+}
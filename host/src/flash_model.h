@@ -0,0 +1,109 @@
+/**
+  ******************************************************************************
+  * @file    flash_model.h
+  * @author  MCD Application Team
+  * @brief   Host build of the XSPI BSP: model of the MX25R3235F memory. The
+  *          array is held in RAM, optionally loaded from and saved to an image
+  *          file. The model runs the command frames sent by the XSPI HAL at a
+  *          given time, and simulates the program, erase and status register
+  *          write durations, the write in progress bit, the program and erase
+  *          suspend, the deep power-down and the reset.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef FLASH_MODEL_H
+#define FLASH_MODEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define FLASH_MODEL_SIZE                0x400000U  /* 4 MBytes */
+#define FLASH_MODEL_SECTOR_SIZE         0x1000U    /* Erase counter granularity */
+#define FLASH_MODEL_SECTORS_NUMBER      (FLASH_MODEL_SIZE / FLASH_MODEL_SECTOR_SIZE)
+
+#define FLASH_MODEL_OK                  0
+#define FLASH_MODEL_ERROR               -1
+
+/* Exported types ------------------------------------------------------------*/
+/* Durations in us, typical values of the MX25R3235F datasheet in high performance mode */
+typedef struct
+{
+  uint32_t PageProgram;                 /*!< tPP                                          */
+  uint32_t SectorErase;                 /*!< tSE, 4KB                                     */
+  uint32_t BlockErase32K;               /*!< tBE32                                        */
+  uint32_t BlockErase64K;               /*!< tBE                                          */
+  uint32_t ChipErase;                   /*!< tCE                                          */
+  uint32_t WriteStatus;                 /*!< tW                                           */
+  uint32_t SuspendLatency;              /*!< tPSL/tESL, suspend command to ready          */
+  uint32_t PowerDownEntry;              /*!< tDP, DP command to deep power-down           */
+  uint32_t PowerDownExit;               /*!< tRDP, chip select pulse to ready             */
+  uint32_t ResetReady;                  /*!< tREADY2 when idle                            */
+  uint32_t ResetReadyBusy;              /*!< tREADY2 during an erase                      */
+} FLASH_MODEL_Timing_t;
+
+typedef struct
+{
+  uint32_t Frames;                      /*!< Command frames received                      */
+  uint32_t Reads;                       /*!< Array read commands                          */
+  uint64_t ReadBytes;                   /*!< Bytes read from the array                    */
+  uint32_t Programs;                    /*!< Page programs                                */
+  uint64_t ProgramBytes;                /*!< Bytes programmed                             */
+  uint32_t Erases;                      /*!< Sector, block and chip erases                */
+  uint32_t StatusReads;                 /*!< Status register reads                        */
+  uint32_t BusyStatusReads;             /*!< Status register reads with WIP set           */
+  uint32_t Suspends;                    /*!< Program and erase suspends                   */
+  uint32_t Resumes;                     /*!< Program and erase resumes                    */
+  uint32_t PowerDowns;                  /*!< Deep power-down entries                      */
+  uint32_t Resets;                      /*!< Software resets                              */
+  uint32_t Violations;                  /*!< Commands ignored by the memory: sent while
+                                             busy or in deep power-down, or program and
+                                             erase without write enable                   */
+  uint64_t BusyTime;                    /*!< Time with WIP set in ns                      */
+} FLASH_MODEL_Stats_t;
+
+/* Command frame, the mode of each phase being its number of lines, 0 if absent */
+typedef struct
+{
+  uint32_t Instruction;
+  uint32_t InstructionLines;
+  uint32_t Address;
+  uint32_t AddressLines;
+  uint32_t AlternateBytes;
+  uint32_t AlternateBytesLines;
+  uint32_t DummyCycles;
+  uint32_t DataLines;
+} FLASH_MODEL_Frame_t;
+
+/* Exported functions --------------------------------------------------------*/
+int32_t  FLASH_MODEL_Init(const char *pImagePath, const FLASH_MODEL_Timing_t *pTiming);
+int32_t  FLASH_MODEL_DeInit(void);
+void     FLASH_MODEL_GetDefaultTiming(FLASH_MODEL_Timing_t *pTiming);
+void     FLASH_MODEL_Transfer(uint64_t Now, const FLASH_MODEL_Frame_t *pFrame, uint8_t *pData, uint32_t Size,
+                              uint32_t Write);
+void     FLASH_MODEL_MemoryMapped(uint64_t Now, const FLASH_MODEL_Frame_t *pFrame);
+uint8_t *FLASH_MODEL_GetArray(void);
+void     FLASH_MODEL_GetStats(uint64_t Now, FLASH_MODEL_Stats_t *pStats);
+void     FLASH_MODEL_ResetStats(void);
+uint32_t FLASH_MODEL_GetEraseCount(uint32_t Sector);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLASH_MODEL_H */
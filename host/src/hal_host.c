@@ -0,0 +1,735 @@
+/**
+  ******************************************************************************
+  * @file    hal_host.c
+  * @author  MCD Application Team
+  * @brief   Host build of the XSPI BSP: HAL and CMSIS functions on a virtual time
+  *          base. The time only advances with the cycle counter reads, the HAL
+  *          tick reads and the XSPI frames, whose duration is computed from the
+  *          XSPI clock and the number of lines of each phase. The frames are run
+  *          by the MX25R3235F model at the time of their end.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include "stm32wbaxx_hal.h"
+#include "hal_host.h"
+#include "flash_model.h"
+
+/* Private define ------------------------------------------------------------*/
+#define HOST_CORE_CLOCK                 100000000U /* CPU clock in Hz */
+#define HOST_XSPI_KERNEL_CLOCK          100000000U /* XSPI kernel clock in Hz */
+#define HOST_DWT_ACCESS_CYCLES          4U         /* Cycle counter read in a polling loop */
+#define HOST_TICK_ACCESS_CYCLES         10U        /* HAL_GetTick() call */
+#define HOST_XSPI_CMD_CYCLES            60U        /* HAL_XSPI_Command() and its transfer call */
+#define HOST_XSPI_CS_HIGH_CYCLES        2U         /* Chip select high time in XSPI clock cycles */
+#define HOST_CRC_CYCLES_PER_WORD        4U         /* CRC unit feed */
+#define HOST_XSPI_TX_SIZE               256U       /* Largest data phase fed through the data register */
+
+/* Private variables ---------------------------------------------------------*/
+static uint64_t Host_Cycles;
+static uint32_t Host_Primask;
+static DWT_Type Host_Dwt;
+static XSPI_RegularCmdTypeDef Host_ReadCfg;
+static XSPI_RegularCmdTypeDef Host_PendingCmd;
+static uint32_t Host_CmdPending;
+static uint8_t  Host_TxData[HOST_XSPI_TX_SIZE];
+static uint32_t Host_TxCount;
+static uint32_t Host_TxWritten;
+static FILE *Host_ComFile;
+
+/* Exported variables --------------------------------------------------------*/
+uint32_t            SystemCoreClock = HOST_CORE_CLOCK;
+CoreDebug_Type      HOST_CoreDebug;
+XSPI_TypeDef        HOST_Xspi1;
+CRC_TypeDef         HOST_Crc;
+ICACHE_TypeDef      HOST_ICache;
+DMA_Channel_TypeDef HOST_DmaChannel[8];
+GPIO_TypeDef        HOST_Gpio[8];
+USART_TypeDef       HOST_Usart1;
+uint8_t            *HOST_XspiWindow;
+UART_HandleTypeDef  hcom_uart[1];
+
+/* Private function prototypes -----------------------------------------------*/
+static void     HOST_Frame(XSPI_HandleTypeDef *hxspi, const XSPI_RegularCmdTypeDef *pCmd, uint8_t *pData,
+                           uint32_t Write);
+static void     HOST_FrameOf(const XSPI_RegularCmdTypeDef *pCmd, FLASH_MODEL_Frame_t *pFrame);
+static uint32_t HOST_PhaseBits(uint32_t Bits, uint32_t Lines);
+
+/* Virtual time ---------------------------------------------------------------*/
+/**
+  * @brief  Advances the virtual time.
+  * @param  Cycles CPU cycles
+  * @retval None
+  */
+void HOST_Advance(uint64_t Cycles)
+{
+  Host_Cycles += Cycles;
+}
+
+/**
+  * @brief  Returns the virtual time in CPU cycles.
+  * @retval CPU cycles since the start
+  */
+uint64_t HOST_GetCycles(void)
+{
+  return Host_Cycles;
+}
+
+/**
+  * @brief  Returns the virtual time in ns.
+  * @retval ns since the start
+  */
+uint64_t HOST_GetTimeNs(void)
+{
+  return (Host_Cycles * 1000000000ULL) / SystemCoreClock;
+}
+
+/**
+  * @brief  Sets the file receiving the output of the COM port, NULL to drop it.
+  * @param  pFile File
+  * @retval None
+  */
+void HOST_SetComOutput(FILE *pFile)
+{
+  Host_ComFile = pFile;
+}
+
+/**
+  * @brief  Reads the cycle counter registers: each read takes a few cycles.
+  * @retval Pointer to the cycle counter registers
+  */
+DWT_Type *HOST_DwtAccess(void)
+{
+  Host_Cycles += HOST_DWT_ACCESS_CYCLES;
+  Host_Dwt.CYCCNT = (uint32_t)Host_Cycles;
+  return &Host_Dwt;
+}
+
+uint32_t HAL_GetTick(void)
+{
+  Host_Cycles += HOST_TICK_ACCESS_CYCLES;
+  return (uint32_t)(Host_Cycles / (SystemCoreClock / 1000U));
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  Host_Cycles += (uint64_t)Delay * (SystemCoreClock / 1000U);
+}
+
+uint32_t HAL_RCC_GetHCLKFreq(void)
+{
+  return SystemCoreClock;
+}
+
+/* Core ----------------------------------------------------------------------*/
+uint32_t __get_PRIMASK(void)
+{
+  return Host_Primask;
+}
+
+void __set_PRIMASK(uint32_t PriMask)
+{
+  Host_Primask = PriMask;
+}
+
+uint32_t __get_IPSR(void)
+{
+  /* No interrupt: the BSP always runs in thread mode */
+  return 0U;
+}
+
+void __disable_irq(void)
+{
+  Host_Primask = 1U;
+}
+
+void __enable_irq(void)
+{
+  Host_Primask = 0U;
+}
+
+void __WFI(void)
+{
+  /* No interrupt source: time goes on */
+  Host_Cycles += SystemCoreClock / 1000000U;
+}
+
+void __DSB(void)
+{
+}
+
+void __ISB(void)
+{
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+  UNUSED(IRQn);
+  UNUSED(PreemptPriority);
+  UNUSED(SubPriority);
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  UNUSED(IRQn);
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  UNUSED(IRQn);
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, const GPIO_InitTypeDef *pGPIO_Init)
+{
+  UNUSED(GPIOx);
+  UNUSED(pGPIO_Init);
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin)
+{
+  UNUSED(GPIOx);
+  UNUSED(GPIO_Pin);
+}
+
+/* DMA: not simulated --------------------------------------------------------*/
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+  UNUSED(hdma);
+  return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma)
+{
+  UNUSED(hdma);
+  return HAL_OK;
+}
+
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
+{
+  UNUSED(hdma);
+}
+
+/* XSPI ----------------------------------------------------------------------*/
+HAL_StatusTypeDef HAL_XSPI_Init(XSPI_HandleTypeDef *hxspi)
+{
+  if ((hxspi == NULL) || (hxspi->Init.ClockPrescaler > 255U))
+  {
+    return HAL_ERROR;
+  }
+
+  HOST_XspiWindow = FLASH_MODEL_GetArray();
+  Host_CmdPending = 0U;
+  hxspi->State = HAL_XSPI_STATE_READY;
+  hxspi->ErrorCode = 0U;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_XSPI_DeInit(XSPI_HandleTypeDef *hxspi)
+{
+  hxspi->State = HAL_XSPI_STATE_RESET;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Configures a command: the ones without data are sent at once, the others
+  *         with the following transmit or receive.
+  */
+HAL_StatusTypeDef HAL_XSPI_Command(XSPI_HandleTypeDef *hxspi, const XSPI_RegularCmdTypeDef *pCmd, uint32_t Timeout)
+{
+  UNUSED(Timeout);
+
+  if ((hxspi->State != HAL_XSPI_STATE_READY) && (hxspi->State != HAL_XSPI_STATE_CMD_CFG))
+  {
+    return HAL_ERROR;
+  }
+
+  Host_Cycles += HOST_XSPI_CMD_CYCLES;
+
+  if (pCmd->OperationType == HAL_XSPI_OPTYPE_READ_CFG)
+  {
+    Host_ReadCfg = *pCmd;
+    hxspi->State = HAL_XSPI_STATE_CMD_CFG;
+  }
+  else if (pCmd->OperationType == HAL_XSPI_OPTYPE_WRITE_CFG)
+  {
+    hxspi->State = HAL_XSPI_STATE_CMD_CFG;
+  }
+  else if (pCmd->DataMode == HAL_XSPI_DATA_NONE)
+  {
+    HOST_Frame(hxspi, pCmd, NULL, 0U);
+    hxspi->State = HAL_XSPI_STATE_READY;
+  }
+  else if (pCmd->DataLength == 0U)
+  {
+    return HAL_ERROR;
+  }
+  else
+  {
+    Host_PendingCmd = *pCmd;
+    Host_CmdPending = 1U;
+    Host_TxCount    = 0U;
+    Host_TxWritten  = 0U;
+    hxspi->State = HAL_XSPI_STATE_READY;
+  }
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_XSPI_Transmit(XSPI_HandleTypeDef *hxspi, const uint8_t *pData, uint32_t Timeout)
+{
+  UNUSED(Timeout);
+
+  if ((Host_CmdPending == 0U) || (pData == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  Host_CmdPending = 0U;
+  HOST_Frame(hxspi, &Host_PendingCmd, (uint8_t *)pData, 1U);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_XSPI_Receive(XSPI_HandleTypeDef *hxspi, uint8_t *pData, uint32_t Timeout)
+{
+  UNUSED(Timeout);
+
+  if ((Host_CmdPending == 0U) || (pData == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  Host_CmdPending = 0U;
+  HOST_Frame(hxspi, &Host_PendingCmd, pData, 0U);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_XSPI_MemoryMapped(XSPI_HandleTypeDef *hxspi, const XSPI_MemoryMappedTypeDef *pCfg)
+{
+  FLASH_MODEL_Frame_t frame;
+
+  UNUSED(pCfg);
+
+  if (hxspi->State != HAL_XSPI_STATE_CMD_CFG)
+  {
+    return HAL_ERROR;
+  }
+
+  HOST_FrameOf(&Host_ReadCfg, &frame);
+  FLASH_MODEL_MemoryMapped(HOST_GetTimeNs(), &frame);
+  hxspi->State = HAL_XSPI_STATE_BUSY_MEM_MAPPED;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_XSPI_Abort(XSPI_HandleTypeDef *hxspi)
+{
+  Host_CmdPending = 0U;
+  Host_TxCount    = 0U;
+  Host_TxWritten  = 0U;
+  hxspi->State = HAL_XSPI_STATE_READY;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Reads a flag of an indirect write fed byte by byte through the data register,
+  *         as HAL_XSPI_Transmit() does: each byte written after a FIFO threshold flag is
+  *         taken at the next flag read, and the frame is sent once the data phase is full.
+  */
+FlagStatus HOST_XspiGetFlag(XSPI_HandleTypeDef *hxspi, uint32_t Flag)
+{
+  if (Host_TxWritten != 0U)
+  {
+    Host_TxWritten = 0U;
+    Host_TxData[Host_TxCount] = (uint8_t)hxspi->Instance->DR;
+    Host_TxCount++;
+  }
+
+  if ((Host_CmdPending != 0U) && (Host_PendingCmd.DataLength <= HOST_XSPI_TX_SIZE))
+  {
+    if (Host_TxCount < Host_PendingCmd.DataLength)
+    {
+      /* Room in the FIFO for the next byte */
+      hxspi->Instance->SR |= HAL_XSPI_FLAG_FT;
+      Host_TxWritten = (Flag == HAL_XSPI_FLAG_FT) ? 1U : 0U;
+    }
+    else
+    {
+      Host_CmdPending = 0U;
+      Host_TxCount    = 0U;
+      HOST_Frame(hxspi, &Host_PendingCmd, Host_TxData, 1U);
+      hxspi->Instance->SR = (hxspi->Instance->SR & ~HAL_XSPI_FLAG_FT) | HAL_XSPI_FLAG_TC;
+    }
+  }
+  else
+  {
+    hxspi->Instance->SR &= ~HAL_XSPI_FLAG_FT;
+  }
+
+  return ((hxspi->Instance->SR & Flag) != 0U) ? SET : RESET;
+}
+
+void HOST_XspiClearFlag(XSPI_HandleTypeDef *hxspi, uint32_t Flag)
+{
+  hxspi->Instance->SR &= ~Flag;
+}
+
+uint32_t HAL_XSPI_GetState(const XSPI_HandleTypeDef *hxspi)
+{
+  return hxspi->State;
+}
+
+/* Interrupt and DMA transfers are not simulated */
+HAL_StatusTypeDef HAL_XSPI_Command_IT(XSPI_HandleTypeDef *hxspi, const XSPI_RegularCmdTypeDef *pCmd)
+{
+  UNUSED(hxspi);
+  UNUSED(pCmd);
+  return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_XSPI_AutoPolling(XSPI_HandleTypeDef *hxspi, const XSPI_AutoPollingTypeDef *pCfg,
+                                       uint32_t Timeout)
+{
+  UNUSED(hxspi);
+  UNUSED(pCfg);
+  UNUSED(Timeout);
+  return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_XSPI_AutoPolling_IT(XSPI_HandleTypeDef *hxspi, const XSPI_AutoPollingTypeDef *pCfg)
+{
+  UNUSED(hxspi);
+  UNUSED(pCfg);
+  return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_XSPI_Transmit_IT(XSPI_HandleTypeDef *hxspi, const uint8_t *pData)
+{
+  UNUSED(hxspi);
+  UNUSED(pData);
+  return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_XSPI_Receive_IT(XSPI_HandleTypeDef *hxspi, uint8_t *pData)
+{
+  UNUSED(hxspi);
+  UNUSED(pData);
+  return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_XSPI_Transmit_DMA(XSPI_HandleTypeDef *hxspi, const uint8_t *pData)
+{
+  UNUSED(hxspi);
+  UNUSED(pData);
+  return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_XSPI_Receive_DMA(XSPI_HandleTypeDef *hxspi, uint8_t *pData)
+{
+  UNUSED(hxspi);
+  UNUSED(pData);
+  return HAL_ERROR;
+}
+
+void HAL_XSPI_IRQHandler(XSPI_HandleTypeDef *hxspi)
+{
+  UNUSED(hxspi);
+}
+
+HAL_StatusTypeDef HAL_XSPI_SetFifoThreshold(XSPI_HandleTypeDef *hxspi, uint32_t Threshold)
+{
+  hxspi->Init.FifoThresholdByte = Threshold;
+  return HAL_OK;
+}
+
+uint32_t HAL_XSPI_GetFifoThreshold(const XSPI_HandleTypeDef *hxspi)
+{
+  return hxspi->Init.FifoThresholdByte;
+}
+
+HAL_StatusTypeDef HAL_XSPI_RegisterCallback(XSPI_HandleTypeDef *hxspi, HAL_XSPI_CallbackIDTypeDef CallbackID,
+                                            pXSPI_CallbackTypeDef pCallback)
+{
+  UNUSED(hxspi);
+  UNUSED(CallbackID);
+  UNUSED(pCallback);
+  return HAL_OK;
+}
+
+/* The delay block is not simulated: any phase samples the data correctly */
+HAL_StatusTypeDef HAL_XSPI_DLYB_SetConfig(XSPI_HandleTypeDef *hxspi, const HAL_XSPI_DLYB_CfgTypeDef *pDlyb)
+{
+  UNUSED(hxspi);
+  UNUSED(pDlyb);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_XSPI_DLYB_GetConfig(const XSPI_HandleTypeDef *hxspi, HAL_XSPI_DLYB_CfgTypeDef *pDlyb)
+{
+  UNUSED(hxspi);
+  pDlyb->Units    = 0U;
+  pDlyb->PhaseSel = 0U;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_XSPI_DLYB_GetClockPeriod(XSPI_HandleTypeDef *hxspi, HAL_XSPI_DLYB_CfgTypeDef *pDlyb)
+{
+  UNUSED(hxspi);
+  /* The 12 phases of the delay line fit in a clock period */
+  pDlyb->Units    = 32U;
+  pDlyb->PhaseSel = 12U;
+  return HAL_OK;
+}
+
+/* CRC -----------------------------------------------------------------------*/
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *hcrc)
+{
+  hcrc->Instance->POL  = (hcrc->Init.DefaultPolynomialUse == DEFAULT_POLYNOMIAL_ENABLE) ? DEFAULT_CRC32_POLY :
+                         hcrc->Init.GeneratingPolynomial;
+  hcrc->Instance->INIT = (hcrc->Init.DefaultInitValueUse == DEFAULT_INIT_VALUE_ENABLE) ? DEFAULT_CRC_INITVALUE :
+                         hcrc->Init.InitValue;
+  hcrc->Instance->CR   = (hcrc->Init.InputDataInversionMode << 5) | (hcrc->Init.OutputDataInversionMode << 7);
+  hcrc->Instance->DR   = hcrc->Instance->INIT;
+  hcrc->State = 1U;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CRC_DeInit(CRC_HandleTypeDef *hcrc)
+{
+  hcrc->Instance->CR   = 0U;
+  hcrc->Instance->POL  = DEFAULT_CRC32_POLY;
+  hcrc->Instance->INIT = DEFAULT_CRC_INITVALUE;
+  hcrc->Instance->DR   = DEFAULT_CRC_INITVALUE;
+  hcrc->State = 0U;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Feeds the CRC unit with the buffer in the input data format of the handle,
+  *         each unit being bit reversed according to the input inversion mode.
+  */
+uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  const uint8_t *bytes = (const uint8_t *)pBuffer;
+  uint32_t unit = (hcrc->InputDataFormat == CRC_INPUTDATA_FORMAT_WORDS) ? 4U :
+                  ((hcrc->InputDataFormat == CRC_INPUTDATA_FORMAT_HALFWORDS) ? 2U : 1U);
+  uint32_t inversion = (hcrc->Instance->CR >> 5) & 3U;
+  uint32_t crc = hcrc->Instance->DR;
+  uint32_t index;
+  uint32_t bit;
+  uint32_t value;
+  uint32_t width;
+  uint32_t reversed;
+  uint32_t byte;
+
+  for (index = 0U; index < BufferLength; index++)
+  {
+    /* Little endian load of the unit */
+    value = 0U;
+    for (byte = 0U; byte < unit; byte++)
+    {
+      value |= (uint32_t)bytes[(index * unit) + byte] << (8U * byte);
+    }
+
+    width = unit * 8U;
+    if (inversion != CRC_INPUTDATA_INVERSION_NONE)
+    {
+      /* Bit reversal by byte, half-word or word, limited to the unit */
+      reversed = 0U;
+      for (bit = 0U; bit < width; bit++)
+      {
+        uint32_t group = (inversion == CRC_INPUTDATA_INVERSION_BYTE) ? 8U :
+                         ((inversion == CRC_INPUTDATA_INVERSION_HALFWORD) ? 16U : 32U);
+        group = (group > width) ? width : group;
+        if ((value & (1UL << bit)) != 0U)
+        {
+          reversed |= 1UL << (((bit / group) * group) + (group - 1U - (bit % group)));
+        }
+      }
+      value = reversed;
+    }
+
+    /* MSB first */
+    for (bit = width; bit > 0U; bit--)
+    {
+      uint32_t in = (value >> (bit - 1U)) & 1U;
+      uint32_t msb = crc >> 31;
+      crc <<= 1;
+      if ((in ^ msb) != 0U)
+      {
+        crc ^= hcrc->Instance->POL;
+      }
+    }
+    Host_Cycles += HOST_CRC_CYCLES_PER_WORD;
+  }
+
+  hcrc->Instance->DR = crc;
+
+  if (((hcrc->Instance->CR >> 7) & 1U) != 0U)
+  {
+    reversed = 0U;
+    for (bit = 0U; bit < 32U; bit++)
+    {
+      if ((crc & (1UL << bit)) != 0U)
+      {
+        reversed |= 1UL << (31U - bit);
+      }
+    }
+    crc = reversed;
+  }
+
+  return crc;
+}
+
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  hcrc->Instance->DR = hcrc->Instance->INIT;
+  return HAL_CRC_Accumulate(hcrc, pBuffer, BufferLength);
+}
+
+HAL_StatusTypeDef HAL_CRCEx_Input_Data_Reverse(CRC_HandleTypeDef *hcrc, uint32_t InputReverseMode)
+{
+  hcrc->Instance->CR = (hcrc->Instance->CR & ~(3UL << 5)) | (InputReverseMode << 5);
+  return HAL_OK;
+}
+
+/* ICACHE: not simulated, the code alias of the XSPI window does not exist on the host */
+HAL_StatusTypeDef HAL_ICACHE_Enable(void)
+{
+  HOST_ICache.CR |= ICACHE_CR_EN;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ICACHE_Disable(void)
+{
+  HOST_ICache.CR &= ~ICACHE_CR_EN;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ICACHE_Invalidate(void)
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ICACHE_EnableRemapRegion(uint32_t Region, const ICACHE_RegionConfigTypeDef *pRegionConfig)
+{
+  UNUSED(Region);
+  UNUSED(pRegionConfig);
+  return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_ICACHE_DisableRemapRegion(uint32_t Region)
+{
+  UNUSED(Region);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ICACHE_Monitor_Start(uint32_t MonitorType)
+{
+  UNUSED(MonitorType);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ICACHE_Monitor_Stop(uint32_t MonitorType)
+{
+  UNUSED(MonitorType);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ICACHE_Monitor_Reset(uint32_t MonitorType)
+{
+  UNUSED(MonitorType);
+  return HAL_OK;
+}
+
+uint32_t HAL_ICACHE_Monitor_GetHitValue(void)
+{
+  return 0U;
+}
+
+uint32_t HAL_ICACHE_Monitor_GetMissValue(void)
+{
+  return 0U;
+}
+
+/* UART ----------------------------------------------------------------------*/
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size,
+                                    uint32_t Timeout)
+{
+  UNUSED(huart);
+  UNUSED(Timeout);
+
+  if ((Host_ComFile != NULL) && (fwrite(pData, 1U, Size, Host_ComFile) != Size))
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Sends a frame: advances the time of its duration, then runs it in the model.
+  * @param  hxspi XSPI handle
+  * @param  pCmd  Command of the frame
+  * @param  pData Data of the frame, NULL if none
+  * @param  Write 1 for a transmit, 0 for a receive
+  * @retval None
+  */
+static void HOST_Frame(XSPI_HandleTypeDef *hxspi, const XSPI_RegularCmdTypeDef *pCmd, uint8_t *pData,
+                       uint32_t Write)
+{
+  FLASH_MODEL_Frame_t frame;
+  uint64_t clocks;
+  uint32_t size = (pData != NULL) ? pCmd->DataLength : 0U;
+
+  HOST_FrameOf(pCmd, &frame);
+
+  clocks = (uint64_t)HOST_PhaseBits(8U, frame.InstructionLines) + HOST_PhaseBits(24U, frame.AddressLines) +
+           HOST_PhaseBits(8U, frame.AlternateBytesLines) + frame.DummyCycles +
+           HOST_PhaseBits(8U * size, frame.DataLines) + HOST_XSPI_CS_HIGH_CYCLES;
+
+  /* XSPI clock = kernel clock / (prescaler + 1) */
+  Host_Cycles += (clocks * (hxspi->Init.ClockPrescaler + 1U) * (uint64_t)SystemCoreClock) / HOST_XSPI_KERNEL_CLOCK;
+
+  FLASH_MODEL_Transfer(HOST_GetTimeNs(), &frame, pData, size, Write);
+}
+
+/**
+  * @brief  Converts a HAL command into a model frame.
+  * @param  pCmd   Command
+  * @param  pFrame Frame
+  * @retval None
+  */
+static void HOST_FrameOf(const XSPI_RegularCmdTypeDef *pCmd, FLASH_MODEL_Frame_t *pFrame)
+{
+  pFrame->Instruction         = pCmd->Instruction;
+  pFrame->InstructionLines    = pCmd->InstructionMode;
+  pFrame->Address             = pCmd->Address;
+  pFrame->AddressLines        = pCmd->AddressMode;
+  pFrame->AlternateBytes      = pCmd->AlternateBytes;
+  pFrame->AlternateBytesLines = pCmd->AlternateBytesMode;
+  pFrame->DummyCycles         = pCmd->DummyCycles;
+  pFrame->DataLines           = pCmd->DataMode;
+}
+
+/**
+  * @brief  Returns the clock cycles of a phase.
+  * @param  Bits  Bits of the phase
+  * @param  Lines Lines of the phase, 0 if absent
+  * @retval Clock cycles
+  */
+static uint32_t HOST_PhaseBits(uint32_t Bits, uint32_t Lines)
+{
+  return (Lines == 0U) ? 0U : ((Bits + Lines - 1U) / Lines);
+}
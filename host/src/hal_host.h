@@ -0,0 +1,41 @@
+/**
+  ******************************************************************************
+  * @file    hal_host.h
+  * @author  MCD Application Team
+  * @brief   Host build of the XSPI BSP: virtual time base of hal_host.c.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef HAL_HOST_H
+#define HAL_HOST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+
+/* Exported functions --------------------------------------------------------*/
+void     HOST_Advance(uint64_t Cycles);
+uint64_t HOST_GetCycles(void);
+uint64_t HOST_GetTimeNs(void);
+void     HOST_SetComOutput(FILE *pFile);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_HOST_H */
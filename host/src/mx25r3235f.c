@@ -0,0 +1,501 @@
+/**
+  ******************************************************************************
+  * @file    mx25r3235f.c
+  * @author  MCD Application Team
+  * @brief   Host build of the XSPI BSP: MX25R3235F component driver, limited to
+  *          the functions used by stm32wbaxx_nucleo_xspi.c. Each function sends
+  *          the command frame of the datasheet through the XSPI HAL.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "../Components/mx25r3235f/mx25r3235f.h"
+
+/* Private define ------------------------------------------------------------*/
+#define MX25R3235F_DUMMY_CYCLES_DREAD      8U   /* Dummy cycles of DREAD */
+#define MX25R3235F_DUMMY_CYCLES_2READ      4U   /* Dummy cycles of 2READ */
+#define MX25R3235F_DUMMY_CYCLES_QREAD      8U   /* Dummy cycles of QREAD */
+#define MX25R3235F_DREAD_CMD               0x3BU
+#define MX25R3235F_2READ_CMD               0xBBU
+#define MX25R3235F_QREAD_CMD               0x6BU
+
+/* Private function prototypes -----------------------------------------------*/
+static void    MX25R3235F_InitCommand(XSPI_RegularCmdTypeDef *pCmd, uint32_t Instruction);
+static void    MX25R3235F_InitReadCommand(XSPI_RegularCmdTypeDef *pCmd, MX25R3235F_Interface_t Mode);
+static void    MX25R3235F_InitProgramCommand(XSPI_RegularCmdTypeDef *pCmd, MX25R3235F_Interface_t Mode);
+static int32_t MX25R3235F_SendCommand(XSPI_HandleTypeDef *Ctx, uint32_t Instruction);
+static int32_t MX25R3235F_ReadRegister(XSPI_HandleTypeDef *Ctx, uint32_t Instruction, uint8_t *pData,
+                                       uint32_t Size);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Get Flash information
+  * @param  pInfo pointer to information structure
+  * @retval error status
+  */
+int32_t MX25R3235F_GetFlashInfo(MX25R3235F_Info_t *pInfo)
+{
+  pInfo->FlashSize             = MX25R3235F_FLASH_SIZE;
+  pInfo->EraseSectorSize       = MX25R3235F_SECTOR_64K;
+  pInfo->EraseSectorsNumber    = (MX25R3235F_FLASH_SIZE / MX25R3235F_SECTOR_64K);
+  pInfo->EraseSubSectorSize    = MX25R3235F_BLOCK_32K;
+  pInfo->EraseSubSectorNumber  = (MX25R3235F_FLASH_SIZE / MX25R3235F_BLOCK_32K);
+  pInfo->EraseSubSector1Size   = MX25R3235F_SUBSECTOR_4K;
+  pInfo->EraseSubSector1Number = (MX25R3235F_FLASH_SIZE / MX25R3235F_SUBSECTOR_4K);
+  pInfo->ProgPageSize          = MX25R3235F_PAGE_SIZE;
+  pInfo->ProgPagesNumber       = (MX25R3235F_FLASH_SIZE / MX25R3235F_PAGE_SIZE);
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Reads an amount of data from the memory with the read command of the mode.
+  * @param  Ctx      Component object pointer
+  * @param  Mode     Interface mode
+  * @param  pData    Pointer to data to be read
+  * @param  ReadAddr Read start address
+  * @param  Size     Size of data to read
+  * @retval error status
+  */
+int32_t MX25R3235F_Read(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint8_t *pData,
+                        uint32_t ReadAddr, uint32_t Size)
+{
+  XSPI_RegularCmdTypeDef s_command = {0};
+
+  MX25R3235F_InitReadCommand(&s_command, Mode);
+  s_command.Address    = ReadAddr;
+  s_command.DataLength = Size;
+
+  if (HAL_XSPI_Command(Ctx, &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (HAL_XSPI_Receive(Ctx, pData, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Programs up to a page of the memory. The write enable must be sent first.
+  * @param  Ctx       Component object pointer
+  * @param  Mode      Interface mode
+  * @param  pData     Pointer to data to be written
+  * @param  WriteAddr Write start address
+  * @param  Size      Size of data to write, not crossing a page boundary
+  * @retval error status
+  */
+int32_t MX25R3235F_PageProgram(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint8_t *pData,
+                               uint32_t WriteAddr, uint32_t Size)
+{
+  XSPI_RegularCmdTypeDef s_command = {0};
+
+  MX25R3235F_InitProgramCommand(&s_command, Mode);
+  s_command.Address    = WriteAddr;
+  s_command.DataLength = Size;
+
+  if (HAL_XSPI_Command(Ctx, &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (HAL_XSPI_Transmit(Ctx, pData, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Erases a block of the memory. The write enable must be sent first.
+  * @param  Ctx          Component object pointer
+  * @param  BlockAddress Address of the block
+  * @param  BlockSize    Block size
+  * @retval error status
+  */
+int32_t MX25R3235F_BlockErase(XSPI_HandleTypeDef *Ctx, uint32_t BlockAddress, MX25R3235F_Erase_t BlockSize)
+{
+  XSPI_RegularCmdTypeDef s_command = {0};
+
+  switch (BlockSize)
+  {
+    case MX25R3235F_ERASE_4K :
+      MX25R3235F_InitCommand(&s_command, MX25R3235F_SECTOR_ERASE_CMD);
+      break;
+
+    case MX25R3235F_ERASE_32K :
+      MX25R3235F_InitCommand(&s_command, MX25R3235F_BLOCK_ERASE_32K_CMD);
+      break;
+
+    case MX25R3235F_ERASE_64K :
+      MX25R3235F_InitCommand(&s_command, MX25R3235F_BLOCK_ERASE_CMD);
+      break;
+
+    case MX25R3235F_ERASE_CHIP :
+    default :
+      return MX25R3235F_ChipErase(Ctx);
+  }
+
+  s_command.AddressMode = HAL_XSPI_ADDRESS_1_LINE;
+  s_command.Address     = BlockAddress;
+
+  if (HAL_XSPI_Command(Ctx, &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Erases the whole memory. The write enable must be sent first.
+  * @param  Ctx Component object pointer
+  * @retval error status
+  */
+int32_t MX25R3235F_ChipErase(XSPI_HandleTypeDef *Ctx)
+{
+  return MX25R3235F_SendCommand(Ctx, MX25R3235F_CHIP_ERASE_CMD);
+}
+
+/**
+  * @brief  Configures the XSPI in memory-mapped mode with the read and program
+  *         commands of the mode.
+  * @param  Ctx  Component object pointer
+  * @param  Mode Interface mode
+  * @retval error status
+  */
+int32_t MX25R3235F_EnableMemoryMappedMode(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode)
+{
+  XSPI_RegularCmdTypeDef s_command = {0};
+  XSPI_MemoryMappedTypeDef s_mem_mapped_cfg = {0};
+
+  MX25R3235F_InitReadCommand(&s_command, Mode);
+  s_command.OperationType = HAL_XSPI_OPTYPE_READ_CFG;
+
+  if (HAL_XSPI_Command(Ctx, &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  MX25R3235F_InitProgramCommand(&s_command, Mode);
+  s_command.OperationType = HAL_XSPI_OPTYPE_WRITE_CFG;
+
+  if (HAL_XSPI_Command(Ctx, &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  s_mem_mapped_cfg.TimeOutActivation = HAL_XSPI_TIMEOUT_COUNTER_DISABLE;
+
+  if (HAL_XSPI_MemoryMapped(Ctx, &s_mem_mapped_cfg) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Suspends the on-going program or erase.
+  * @param  Ctx Component object pointer
+  * @retval error status
+  */
+int32_t MX25R3235F_Suspend(XSPI_HandleTypeDef *Ctx)
+{
+  return MX25R3235F_SendCommand(Ctx, MX25R3235F_PROG_ERASE_SUSPEND_CMD);
+}
+
+/**
+  * @brief  Resumes the suspended program or erase.
+  * @param  Ctx Component object pointer
+  * @retval error status
+  */
+int32_t MX25R3235F_Resume(XSPI_HandleTypeDef *Ctx)
+{
+  return MX25R3235F_SendCommand(Ctx, MX25R3235F_PROG_ERASE_RESUME_CMD);
+}
+
+/**
+  * @brief  Sets the write enable latch.
+  * @param  Ctx Component object pointer
+  * @retval error status
+  */
+int32_t MX25R3235F_WriteEnable(XSPI_HandleTypeDef *Ctx)
+{
+  return MX25R3235F_SendCommand(Ctx, MX25R3235F_WRITE_ENABLE_CMD);
+}
+
+/**
+  * @brief  Clears the write enable latch.
+  * @param  Ctx Component object pointer
+  * @retval error status
+  */
+int32_t MX25R3235F_WriteDisable(XSPI_HandleTypeDef *Ctx)
+{
+  return MX25R3235F_SendCommand(Ctx, MX25R3235F_WRITE_DISABLE_CMD);
+}
+
+/**
+  * @brief  Reads the status register.
+  * @param  Ctx   Component object pointer
+  * @param  Value Pointer to the register value
+  * @retval error status
+  */
+int32_t MX25R3235F_ReadStatusRegister(XSPI_HandleTypeDef *Ctx, uint8_t *Value)
+{
+  return MX25R3235F_ReadRegister(Ctx, MX25R3235F_READ_STATUS_REG_CMD, Value, 1U);
+}
+
+/**
+  * @brief  Writes the status register. The write enable must be sent first.
+  * @param  Ctx   Component object pointer
+  * @param  Value Register value
+  * @retval error status
+  */
+int32_t MX25R3235F_WriteStatusRegister(XSPI_HandleTypeDef *Ctx, uint8_t Value)
+{
+  XSPI_RegularCmdTypeDef s_command = {0};
+  uint8_t reg = Value;
+
+  MX25R3235F_InitCommand(&s_command, MX25R3235F_WRITE_STATUS_REG_CMD);
+  s_command.DataMode   = HAL_XSPI_DATA_1_LINE;
+  s_command.DataLength = 1U;
+
+  if (HAL_XSPI_Command(Ctx, &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (HAL_XSPI_Transmit(Ctx, &reg, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Reads the security register.
+  * @param  Ctx   Component object pointer
+  * @param  Value Pointer to the register value
+  * @retval error status
+  */
+int32_t MX25R3235F_ReadSecurityRegister(XSPI_HandleTypeDef *Ctx, uint8_t *Value)
+{
+  return MX25R3235F_ReadRegister(Ctx, MX25R3235F_READ_SECURITY_REG_CMD, Value, 1U);
+}
+
+/**
+  * @brief  Puts the memory in deep power-down.
+  * @param  Ctx Component object pointer
+  * @retval error status
+  */
+int32_t MX25R3235F_EnterPowerDown(XSPI_HandleTypeDef *Ctx)
+{
+  return MX25R3235F_SendCommand(Ctx, MX25R3235F_DEEP_POWER_DOWN_CMD);
+}
+
+/**
+  * @brief  Sends the no operation command, whose chip select pulse wakes the memory up
+  *         from the deep power-down.
+  * @param  Ctx Component object pointer
+  * @retval error status
+  */
+int32_t MX25R3235F_NoOperation(XSPI_HandleTypeDef *Ctx)
+{
+  return MX25R3235F_SendCommand(Ctx, MX25R3235F_NO_OPERATION_CMD);
+}
+
+/**
+  * @brief  Reads the 3 bytes of the memory identification.
+  * @param  Ctx Component object pointer
+  * @param  ID  Pointer to the identification
+  * @retval error status
+  */
+int32_t MX25R3235F_ReadID(XSPI_HandleTypeDef *Ctx, uint8_t *ID)
+{
+  return MX25R3235F_ReadRegister(Ctx, MX25R3235F_READ_ID_CMD, ID, 3U);
+}
+
+/**
+  * @brief  Enables the reset of the memory by the next command.
+  * @param  Ctx Component object pointer
+  * @retval error status
+  */
+int32_t MX25R3235F_ResetEnable(XSPI_HandleTypeDef *Ctx)
+{
+  return MX25R3235F_SendCommand(Ctx, MX25R3235F_RESET_ENABLE_CMD);
+}
+
+/**
+  * @brief  Resets the memory.
+  * @param  Ctx Component object pointer
+  * @retval error status
+  */
+int32_t MX25R3235F_ResetMemory(XSPI_HandleTypeDef *Ctx)
+{
+  return MX25R3235F_SendCommand(Ctx, MX25R3235F_RESET_MEMORY_CMD);
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Fills a command structure with an instruction on one line and no other phase.
+  * @param  pCmd        Pointer to the command structure
+  * @param  Instruction Instruction of the command
+  * @retval None
+  */
+static void MX25R3235F_InitCommand(XSPI_RegularCmdTypeDef *pCmd, uint32_t Instruction)
+{
+  pCmd->OperationType         = HAL_XSPI_OPTYPE_COMMON_CFG;
+  pCmd->Instruction           = Instruction;
+  pCmd->InstructionMode       = HAL_XSPI_INSTRUCTION_1_LINE;
+  pCmd->InstructionWidth      = HAL_XSPI_INSTRUCTION_8_BITS;
+  pCmd->InstructionDTRMode    = HAL_XSPI_INSTRUCTION_DTR_DISABLE;
+  pCmd->AddressMode           = HAL_XSPI_ADDRESS_NONE;
+  pCmd->AddressWidth          = HAL_XSPI_ADDRESS_24_BITS;
+  pCmd->AddressDTRMode        = HAL_XSPI_ADDRESS_DTR_DISABLE;
+  pCmd->AlternateBytesMode    = HAL_XSPI_ALT_BYTES_NONE;
+  pCmd->AlternateBytesWidth   = HAL_XSPI_ALT_BYTES_8_BITS;
+  pCmd->AlternateBytesDTRMode = HAL_XSPI_ALT_BYTES_DTR_DISABLE;
+  pCmd->DataMode              = HAL_XSPI_DATA_NONE;
+  pCmd->DataDTRMode           = HAL_XSPI_DATA_DTR_DISABLE;
+  pCmd->DummyCycles           = 0U;
+  pCmd->DQSMode               = HAL_XSPI_DQS_DISABLE;
+  pCmd->SIOOMode              = HAL_XSPI_SIOO_INST_EVERY_CMD;
+}
+
+/**
+  * @brief  Fills a command structure with the read command of an interface mode.
+  * @param  pCmd Pointer to the command structure
+  * @param  Mode Interface mode
+  * @retval None
+  */
+static void MX25R3235F_InitReadCommand(XSPI_RegularCmdTypeDef *pCmd, MX25R3235F_Interface_t Mode)
+{
+  switch (Mode)
+  {
+    case MX25R3235F_DUAL_OUT_MODE :
+      MX25R3235F_InitCommand(pCmd, MX25R3235F_DREAD_CMD);
+      pCmd->AddressMode = HAL_XSPI_ADDRESS_1_LINE;
+      pCmd->DataMode    = HAL_XSPI_DATA_2_LINES;
+      pCmd->DummyCycles = MX25R3235F_DUMMY_CYCLES_DREAD;
+      break;
+
+    case MX25R3235F_DUAL_IO_MODE :
+      MX25R3235F_InitCommand(pCmd, MX25R3235F_2READ_CMD);
+      pCmd->AddressMode = HAL_XSPI_ADDRESS_2_LINES;
+      pCmd->DataMode    = HAL_XSPI_DATA_2_LINES;
+      pCmd->DummyCycles = MX25R3235F_DUMMY_CYCLES_2READ;
+      break;
+
+    case MX25R3235F_QUAD_OUT_MODE :
+      MX25R3235F_InitCommand(pCmd, MX25R3235F_QREAD_CMD);
+      pCmd->AddressMode = HAL_XSPI_ADDRESS_1_LINE;
+      pCmd->DataMode    = HAL_XSPI_DATA_4_LINES;
+      pCmd->DummyCycles = MX25R3235F_DUMMY_CYCLES_QREAD;
+      break;
+
+    case MX25R3235F_QUAD_IO_MODE :
+      MX25R3235F_InitCommand(pCmd, MX25R3235F_4READ_CMD);
+      pCmd->AddressMode        = HAL_XSPI_ADDRESS_4_LINES;
+      pCmd->AlternateBytes     = MX25R3235F_ALT_BYTES_NO_PE_MODE;
+      pCmd->AlternateBytesMode = HAL_XSPI_ALT_BYTES_4_LINES;
+      pCmd->DataMode           = HAL_XSPI_DATA_4_LINES;
+      pCmd->DummyCycles        = MX25R3235F_DUMMY_CYCLES_READ_QUAD;
+      break;
+
+    case MX25R3235F_SPI_MODE :
+    default :
+      MX25R3235F_InitCommand(pCmd, MX25R3235F_FAST_READ_CMD);
+      pCmd->AddressMode = HAL_XSPI_ADDRESS_1_LINE;
+      pCmd->DataMode    = HAL_XSPI_DATA_1_LINE;
+      pCmd->DummyCycles = MX25R3235F_DUMMY_CYCLES_READ;
+      break;
+  }
+}
+
+/**
+  * @brief  Fills a command structure with the page program command of an interface mode.
+  * @param  pCmd Pointer to the command structure
+  * @param  Mode Interface mode
+  * @retval None
+  */
+static void MX25R3235F_InitProgramCommand(XSPI_RegularCmdTypeDef *pCmd, MX25R3235F_Interface_t Mode)
+{
+  if (Mode == MX25R3235F_QUAD_IO_MODE)
+  {
+    MX25R3235F_InitCommand(pCmd, MX25R3235F_QUAD_PAGE_PROG_CMD);
+    pCmd->AddressMode = HAL_XSPI_ADDRESS_4_LINES;
+    pCmd->DataMode    = HAL_XSPI_DATA_4_LINES;
+  }
+  else
+  {
+    MX25R3235F_InitCommand(pCmd, MX25R3235F_PAGE_PROG_CMD);
+    pCmd->AddressMode = HAL_XSPI_ADDRESS_1_LINE;
+    pCmd->DataMode    = HAL_XSPI_DATA_1_LINE;
+  }
+}
+
+/**
+  * @brief  Sends a command made of its instruction only.
+  * @param  Ctx         Component object pointer
+  * @param  Instruction Instruction of the command
+  * @retval error status
+  */
+static int32_t MX25R3235F_SendCommand(XSPI_HandleTypeDef *Ctx, uint32_t Instruction)
+{
+  XSPI_RegularCmdTypeDef s_command = {0};
+
+  MX25R3235F_InitCommand(&s_command, Instruction);
+
+  if (HAL_XSPI_Command(Ctx, &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Reads a register of the memory on one line.
+  * @param  Ctx         Component object pointer
+  * @param  Instruction Instruction of the register read
+  * @param  pData       Pointer to the register value
+  * @param  Size        Size of the register
+  * @retval error status
+  */
+static int32_t MX25R3235F_ReadRegister(XSPI_HandleTypeDef *Ctx, uint32_t Instruction, uint8_t *pData,
+                                       uint32_t Size)
+{
+  XSPI_RegularCmdTypeDef s_command = {0};
+
+  MX25R3235F_InitCommand(&s_command, Instruction);
+  s_command.DataMode   = HAL_XSPI_DATA_1_LINE;
+  s_command.DataLength = Size;
+
+  if (HAL_XSPI_Command(Ctx, &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (HAL_XSPI_Receive(Ctx, pData, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_OK;
+}
@@ -0,0 +1,422 @@
+/**
+  ******************************************************************************
+  * @file    xspi_bench.c
+  * @author  MCD Application Team
+  * @brief   Host build of the XSPI BSP: workload benchmark of the BSP on the
+  *          MX25R3235F model. The sequential read, random read, small write and
+  *          mixed workloads of BSP_XSPI_BenchmarkWorkload() are run through the
+  *          BSP read, write and erase functions. Each operation is timed on the
+  *          virtual time base, and the raw samples give the tail latencies.
+  *          BSP_XSPI_BenchmarkWorkload() is then run for comparison.
+  *          With USE_BSP_XSPI_TRACE, the trace of each workload can be written
+  *          to a file, as sent by BSP_XSPI_DumpTrace(), for xspi_replay.
+  *          The exit status is not zero on a BSP error or on a command which the
+  *          memory would have ignored.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32wbaxx_nucleo_xspi.h"
+#include "hal_host.h"
+#include "flash_model.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Same workloads as BSP_XSPI_BenchmarkWorkload() */
+#define BENCH_READ_SIZE                 256U
+#define BENCH_WRITE_SIZE                16U
+#define BENCH_MIXED_WRITES              77U
+#define BENCH_SEED                      0x12345678U
+
+#define BENCH_DEFAULT_OPS               2000U
+#define BENCH_DEFAULT_ADDRESS           0x100000U
+#define BENCH_DEFAULT_SIZE              0x10000U
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  const char          *pName;
+  BSP_XSPI_Workload_t  Workload;
+} BENCH_Workload_t;
+
+/* Private variables ---------------------------------------------------------*/
+static FILE *Bench_Trace;
+
+static const BENCH_Workload_t Bench_Workloads[] =
+{
+  {"seq",    BSP_XSPI_WORKLOAD_SEQ_READ},
+  {"random", BSP_XSPI_WORKLOAD_RANDOM_READ},
+  {"write",  BSP_XSPI_WORKLOAD_SMALL_WRITE},
+  {"mixed",  BSP_XSPI_WORKLOAD_MIXED},
+};
+
+#define BENCH_WORKLOADS_NUMBER          (sizeof(Bench_Workloads) / sizeof(Bench_Workloads[0]))
+
+/* Private function prototypes -----------------------------------------------*/
+static int32_t  BENCH_Run(const BENCH_Workload_t *pWorkload, uint32_t Address, uint32_t Size, uint32_t NbOps);
+static int      BENCH_Compare(const void *pA, const void *pB);
+static uint64_t BENCH_Percentile(const uint64_t *pSorted, uint32_t Count, uint32_t PerThousand);
+static double   BENCH_Us(uint64_t Cycles);
+static void     BENCH_Usage(const char *pProgram);
+
+/**
+  * @brief  Benchmark entry point.
+  * @param  argc Number of arguments
+  * @param  argv Arguments
+  * @retval 0 if all the workloads ran without error nor ignored command
+  */
+int main(int argc, char *argv[])
+{
+  FLASH_MODEL_Timing_t timing;
+  FLASH_MODEL_Stats_t stats;
+  BSP_XSPI_Init_t init;
+  const char *image = NULL;
+  const char *trace = NULL;
+  const char *workload = "all";
+  uint32_t nb_ops = BENCH_DEFAULT_OPS;
+  uint32_t address = BENCH_DEFAULT_ADDRESS;
+  uint32_t size = BENCH_DEFAULT_SIZE;
+  uint32_t index;
+  uint32_t ran = 0U;
+  int32_t ret = BSP_ERROR_NONE;
+  int arg;
+
+  FLASH_MODEL_GetDefaultTiming(&timing);
+  init.InterfaceMode = BSP_XSPI_QPI_MODE;
+
+  for (arg = 1; arg < argc; arg++)
+  {
+    if ((strcmp(argv[arg], "-m") == 0) && ((arg + 1) < argc))
+    {
+      arg++;
+      init.InterfaceMode = (strcmp(argv[arg], "spi") == 0) ? BSP_XSPI_SPI_MODE : BSP_XSPI_QPI_MODE;
+    }
+    else if ((strcmp(argv[arg], "-w") == 0) && ((arg + 1) < argc))
+    {
+      workload = argv[++arg];
+    }
+    else if ((strcmp(argv[arg], "-n") == 0) && ((arg + 1) < argc))
+    {
+      nb_ops = (uint32_t)strtoul(argv[++arg], NULL, 0);
+    }
+    else if ((strcmp(argv[arg], "-a") == 0) && ((arg + 1) < argc))
+    {
+      address = (uint32_t)strtoul(argv[++arg], NULL, 0);
+    }
+    else if ((strcmp(argv[arg], "-s") == 0) && ((arg + 1) < argc))
+    {
+      size = (uint32_t)strtoul(argv[++arg], NULL, 0);
+    }
+    else if ((strcmp(argv[arg], "-i") == 0) && ((arg + 1) < argc))
+    {
+      image = argv[++arg];
+    }
+    else if ((strcmp(argv[arg], "-p") == 0) && ((arg + 1) < argc))
+    {
+      timing.PageProgram = (uint32_t)strtoul(argv[++arg], NULL, 0);
+    }
+    else if ((strcmp(argv[arg], "-e") == 0) && ((arg + 1) < argc))
+    {
+      timing.SectorErase = (uint32_t)strtoul(argv[++arg], NULL, 0);
+    }
+    else if ((strcmp(argv[arg], "-b") == 0) && ((arg + 1) < argc))
+    {
+      timing.BlockErase64K = (uint32_t)strtoul(argv[++arg], NULL, 0);
+    }
+    else if ((strcmp(argv[arg], "-t") == 0) && ((arg + 1) < argc))
+    {
+      trace = argv[++arg];
+    }
+    else
+    {
+      BENCH_Usage(argv[0]);
+      return 2;
+    }
+  }
+
+  if ((nb_ops == 0U) || (size == 0U) || ((address % BSP_XSPI_BLOCK_4K) != 0U) ||
+      ((size % BSP_XSPI_BLOCK_4K) != 0U) || (address >= MX25R3235F_FLASH_SIZE) ||
+      (size > (MX25R3235F_FLASH_SIZE - address)))
+  {
+    BENCH_Usage(argv[0]);
+    return 2;
+  }
+
+  if (trace != NULL)
+  {
+#if (USE_BSP_XSPI_TRACE == 1)
+    Bench_Trace = fopen(trace, "wb");
+    if (Bench_Trace == NULL)
+    {
+      (void)fprintf(stderr, "cannot create the trace %s\n", trace);
+      return 1;
+    }
+    HOST_SetComOutput(Bench_Trace);
+#else
+    (void)fprintf(stderr, "the trace needs a build with USE_BSP_XSPI_TRACE=1U\n");
+    return 2;
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+  }
+
+  if (FLASH_MODEL_Init(image, &timing) != FLASH_MODEL_OK)
+  {
+    (void)fprintf(stderr, "cannot load the image %s\n", image);
+    return 1;
+  }
+
+  ret = BSP_XSPI_Init(0U, &init);
+  if (ret != BSP_ERROR_NONE)
+  {
+    (void)fprintf(stderr, "BSP_XSPI_Init: %ld\n", (long)ret);
+  }
+
+  (void)printf("%s mode, %lu operations on 0x%06lX-0x%06lX, tPP %luus tSE %luus tBE %luus\n",
+               (init.InterfaceMode == BSP_XSPI_SPI_MODE) ? "SPI" : "QPI", (unsigned long)nb_ops,
+               (unsigned long)address, (unsigned long)(address + size - 1U), (unsigned long)timing.PageProgram,
+               (unsigned long)timing.SectorErase, (unsigned long)timing.BlockErase64K);
+  (void)printf("%-7s %9s %11s %9s %9s %9s %9s %9s | %9s %9s %9s\n", "", "ops/s", "bytes/s", "p50 us", "p90 us",
+               "p99 us", "p99.9 us", "max us", "bsp ops/s", "p99 us", "max us");
+
+  for (index = 0U; (index < BENCH_WORKLOADS_NUMBER) && (ret == BSP_ERROR_NONE); index++)
+  {
+    if ((strcmp(workload, "all") == 0) || (strcmp(workload, Bench_Workloads[index].pName) == 0))
+    {
+      ret = BENCH_Run(&Bench_Workloads[index], address, size, nb_ops);
+      ran++;
+    }
+  }
+
+  if (ran == 0U)
+  {
+    BENCH_Usage(argv[0]);
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+
+  if (BSP_XSPI_DeInit(0U) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  FLASH_MODEL_GetStats(HOST_GetTimeNs(), &stats);
+  if (FLASH_MODEL_DeInit() != FLASH_MODEL_OK)
+  {
+    (void)fprintf(stderr, "cannot save the image %s\n", image);
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  if ((Bench_Trace != NULL) && (fclose(Bench_Trace) != 0))
+  {
+    (void)fprintf(stderr, "cannot write the trace %s\n", trace);
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  return ((ret == BSP_ERROR_NONE) && (stats.Violations == 0U)) ? 0 : 1;
+}
+
+/**
+  * @brief  Runs a workload, then BSP_XSPI_BenchmarkWorkload() with the same parameters,
+  *         and prints the results and the memory activity.
+  * @param  pWorkload Workload
+  * @param  Address   Start address of the area
+  * @param  Size      Size of the area
+  * @param  NbOps     Number of operations
+  * @retval BSP status
+  */
+static int32_t BENCH_Run(const BENCH_Workload_t *pWorkload, uint32_t Address, uint32_t Size, uint32_t NbOps)
+{
+  FLASH_MODEL_Stats_t stats;
+  BSP_XSPI_WorkloadBench_t result = {0};  /* Stays 0 without USE_BSP_XSPI_BENCHMARK */
+  uint8_t buffer[BENCH_READ_SIZE];
+  uint64_t *samples;
+  uint64_t start;
+  uint64_t total = 0U;
+  uint64_t bytes = 0U;
+  uint32_t count = 0U;
+  uint32_t op;
+  uint32_t seed = BENCH_SEED;
+  uint32_t write_offset = 0U;
+  uint32_t offset;
+  int32_t ret;
+
+  /* One more sample for the final flush of the write combining */
+  samples = malloc((NbOps + 1U) * sizeof(uint64_t));
+  if (samples == NULL)
+  {
+    return BSP_ERROR_NO_INIT;
+  }
+
+  for (offset = 0U; offset < BENCH_READ_SIZE; offset++)
+  {
+    buffer[offset] = (uint8_t)offset;
+  }
+
+  ret = BSP_XSPI_EraseRange(0U, Address, Size);
+  FLASH_MODEL_ResetStats();
+#if (USE_BSP_XSPI_TRACE == 1)
+  (void)BSP_XSPI_ResetTrace(0U);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  for (op = 0U; (op < NbOps) && (ret == BSP_ERROR_NONE); op++)
+  {
+    seed = (seed * 1664525U) + 1013904223U;
+
+    start = HOST_GetCycles();
+    if ((pWorkload->Workload == BSP_XSPI_WORKLOAD_SMALL_WRITE) ||
+        ((pWorkload->Workload == BSP_XSPI_WORKLOAD_MIXED) && ((seed >> 24) < BENCH_MIXED_WRITES)))
+    {
+      if ((write_offset + BENCH_WRITE_SIZE) > Size)
+      {
+        ret = BSP_XSPI_EraseRange(0U, Address, Size);
+        write_offset = 0U;
+      }
+      if (ret == BSP_ERROR_NONE)
+      {
+        ret = BSP_XSPI_Write(0U, buffer, Address + write_offset, BENCH_WRITE_SIZE);
+      }
+      write_offset += BENCH_WRITE_SIZE;
+      bytes += BENCH_WRITE_SIZE;
+    }
+    else
+    {
+      if (pWorkload->Workload == BSP_XSPI_WORKLOAD_SEQ_READ)
+      {
+        offset = (op * BENCH_READ_SIZE) % Size;
+      }
+      else
+      {
+        offset = ((seed >> 8) % (Size / BENCH_READ_SIZE)) * BENCH_READ_SIZE;
+      }
+      ret = BSP_XSPI_Read(0U, buffer, Address + offset, BENCH_READ_SIZE);
+      bytes += BENCH_READ_SIZE;
+    }
+    samples[count] = HOST_GetCycles() - start;
+    total += samples[count];
+    count++;
+  }
+
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+  if (ret == BSP_ERROR_NONE)
+  {
+    start = HOST_GetCycles();
+    ret = BSP_XSPI_Flush(0U);
+    samples[count] = HOST_GetCycles() - start;
+    total += samples[count];
+    count++;
+  }
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+
+  FLASH_MODEL_GetStats(HOST_GetTimeNs(), &stats);
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  /* One dump per workload, before the calls of BSP_XSPI_BenchmarkWorkload() */
+  if ((ret == BSP_ERROR_NONE) && (Bench_Trace != NULL))
+  {
+    ret = BSP_XSPI_DumpTrace(0U, COM1);
+    if (count >= BSP_XSPI_TRACE_DEPTH)
+    {
+      (void)printf("        trace: last %lu records, the ring holds BSP_XSPI_TRACE_DEPTH\n",
+                   (unsigned long)BSP_XSPI_TRACE_DEPTH);
+    }
+  }
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+#if (USE_BSP_XSPI_BENCHMARK == 1)
+  if ((ret == BSP_ERROR_NONE) && (total != 0U))
+  {
+    ret = BSP_XSPI_BenchmarkWorkload(0U, pWorkload->Workload, Address, Size, NbOps, &result);
+  }
+#endif /* (USE_BSP_XSPI_BENCHMARK == 1) */
+
+  if ((ret == BSP_ERROR_NONE) && (total != 0U))
+  {
+    qsort(samples, count, sizeof(uint64_t), BENCH_Compare);
+
+    (void)printf("%-7s %9.0f %11.0f %9.1f %9.1f %9.1f %9.1f %9.1f | %9lu %9lu %9lu\n", pWorkload->pName,
+                 ((double)NbOps * SystemCoreClock) / (double)total, ((double)bytes * SystemCoreClock) / (double)total,
+                 BENCH_Us(BENCH_Percentile(samples, count, 500U)), BENCH_Us(BENCH_Percentile(samples, count, 900U)),
+                 BENCH_Us(BENCH_Percentile(samples, count, 990U)), BENCH_Us(BENCH_Percentile(samples, count, 999U)),
+                 BENCH_Us(samples[count - 1U]), (unsigned long)result.OpsPerSecond,
+                 (unsigned long)result.P99Latency, (unsigned long)result.MaxLatency);
+    (void)printf("        memory: %lu reads, %lu programs, %lu erases, %lu/%lu busy status reads, "
+                 "busy %.1f ms, %lu ignored commands since the start\n", (unsigned long)stats.Reads,
+                 (unsigned long)stats.Programs, (unsigned long)stats.Erases, (unsigned long)stats.BusyStatusReads,
+                 (unsigned long)stats.StatusReads, (double)stats.BusyTime / 1000000.0,
+                 (unsigned long)stats.Violations);
+  }
+  else
+  {
+    (void)printf("%-7s error %ld\n", pWorkload->pName, (long)ret);
+    if (ret == BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+  }
+
+  free(samples);
+
+  return ret;
+}
+
+/**
+  * @brief  Compares two samples for qsort().
+  * @param  pA First sample
+  * @param  pB Second sample
+  * @retval Comparison result
+  */
+static int BENCH_Compare(const void *pA, const void *pB)
+{
+  uint64_t a = *(const uint64_t *)pA;
+  uint64_t b = *(const uint64_t *)pB;
+
+  return (a > b) - (a < b);
+}
+
+/**
+  * @brief  Returns a percentile of sorted samples: the smallest sample not exceeded by
+  *         the given part of them.
+  * @param  pSorted     Sorted samples
+  * @param  Count       Number of samples
+  * @param  PerThousand Percentile in 1/1000
+  * @retval Percentile
+  */
+static uint64_t BENCH_Percentile(const uint64_t *pSorted, uint32_t Count, uint32_t PerThousand)
+{
+  uint64_t rank = (((uint64_t)Count * PerThousand) + 999U) / 1000U;
+
+  return pSorted[(rank == 0U) ? 0U : (rank - 1U)];
+}
+
+/**
+  * @brief  Converts CPU cycles in us.
+  * @param  Cycles CPU cycles
+  * @retval Duration in us
+  */
+static double BENCH_Us(uint64_t Cycles)
+{
+  return ((double)Cycles * 1000000.0) / (double)SystemCoreClock;
+}
+
+/**
+  * @brief  Prints the command line options.
+  * @param  pProgram Program name
+  * @retval None
+  */
+static void BENCH_Usage(const char *pProgram)
+{
+  (void)fprintf(stderr,
+                "usage: %s [-m spi|qpi] [-w seq|random|write|mixed|all] [-n ops] [-a address] [-s size]\n"
+                "       [-i image] [-p tPP us] [-e tSE us] [-b tBE us] [-t trace]\n"
+                "  address and size are multiples of 4KB, the area content is lost\n", pProgram);
+}
@@ -0,0 +1,660 @@
+/**
+  ******************************************************************************
+  * @file    xspi_replay.c
+  * @author  MCD Application Team
+  * @brief   Host build of the XSPI BSP: replay of a trace of BSP_XSPI_DumpTrace()
+  *          on the MX25R3235F model. Each record calls the BSP function of the
+  *          recorded operation with the recorded address and size, the written
+  *          data being a pattern. The policy under test is given by the build
+  *          options (read cache, write combining, blank check...) and by the
+  *          command line (interface mode, performance mode, memory timings,
+  *          idle time between the calls). The recorded and projected latencies
+  *          are printed per operation, with the erase counts of the memory.
+  *          The exit status is not zero if the trace cannot be read or on a
+  *          command which the memory would have ignored.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32wbaxx_nucleo_xspi.h"
+#include "hal_host.h"
+#include "flash_model.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Trace format, as BSP_XSPI_TraceHeader_t and BSP_XSPI_TraceRecord_t in little endian */
+#define REPLAY_MAGIC                    0x54505358UL
+#define REPLAY_HEADER_SIZE              16U
+#define REPLAY_RECORD_SIZE              20U
+#define REPLAY_NESTED                   0x80U
+
+#define REPLAY_OPS_NUMBER               32U
+#define REPLAY_CURSORS_NUMBER           8U
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Tick;                        /*!< HAL tick at the start of the call            */
+  uint64_t RecordedNs;                  /*!< Recorded duration                            */
+  uint64_t ReplayedNs;                  /*!< Duration of the replay                       */
+  uint32_t Address;
+  uint32_t Size;
+  uint8_t  Op;                          /*!< Operation, without REPLAY_NESTED             */
+  uint8_t  Nested;                      /*!< Call from an interrupt handler               */
+  int8_t   Status;                      /*!< Recorded status                              */
+  uint8_t  Replayed;                    /*!< 0 if the operation cannot be replayed        */
+  int32_t  ReplayStatus;                /*!< Status of the replay                         */
+} REPLAY_Record_t;
+
+typedef struct
+{
+  uint32_t InterfaceMode;               /*!< BSP_XSPI_Interface_t                         */
+  int32_t  PerformanceMode;             /*!< Forced performance mode, -1 for the recorded */
+  uint32_t KeepIdle;                    /*!< Keep the recorded time between the calls     */
+} REPLAY_Policy_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const char *const Replay_OpNames[REPLAY_OPS_NUMBER] =
+{
+  "read", "write", "flush", "write_async", "read_dma", "erase_block", "erase_chip", "erase_range",
+  "get_status", "enable_mmp", "disable_mmp", "read_id", "suspend_erase", "resume_erase",
+  "suspend_prog", "resume_prog", "enter_pd", "leave_pd", "readv", "writev", "init", "deinit",
+  "stream_open", "stream_next", "stream_close", "submit", "process", "calibrate", "perf_mode",
+  "crc", "hash", NULL
+};
+
+static REPLAY_Record_t  *Replay_Records;
+static uint32_t          Replay_NbRecords;
+static uint8_t           Replay_Data[FLASH_MODEL_SIZE];
+static uint8_t           Replay_ReadData[FLASH_MODEL_SIZE];
+#if (USE_BSP_XSPI_STREAM == 1)
+static BSP_XSPI_Cursor_t Replay_Cursors[REPLAY_CURSORS_NUMBER];
+#endif /* (USE_BSP_XSPI_STREAM == 1) */
+
+/* Private function prototypes -----------------------------------------------*/
+static int32_t  REPLAY_Load(const char *pPath);
+static uint32_t REPLAY_Get32(const uint8_t *pData);
+static void     REPLAY_Run(const REPLAY_Policy_t *pPolicy);
+static int32_t  REPLAY_Call(REPLAY_Record_t *pRecord, const REPLAY_Policy_t *pPolicy);
+static void     REPLAY_Report(void);
+static int      REPLAY_Compare(const void *pA, const void *pB);
+static uint64_t REPLAY_Percentile(const uint64_t *pSorted, uint32_t Count, uint32_t PerThousand);
+static void     REPLAY_Usage(const char *pProgram);
+
+/**
+  * @brief  Replay entry point.
+  * @param  argc Number of arguments
+  * @param  argv Arguments
+  * @retval 0 if the traces were replayed without ignored command
+  */
+int main(int argc, char *argv[])
+{
+  FLASH_MODEL_Timing_t timing;
+  FLASH_MODEL_Stats_t stats;
+  REPLAY_Policy_t policy;
+  const char *image = NULL;
+  uint32_t offset;
+  int status = 0;
+  int arg;
+
+  FLASH_MODEL_GetDefaultTiming(&timing);
+  policy.InterfaceMode   = BSP_XSPI_QPI_MODE;
+  policy.PerformanceMode = -1;
+  policy.KeepIdle        = 0U;
+
+  for (arg = 1; (arg < argc) && (argv[arg][0] == '-'); arg++)
+  {
+    if ((strcmp(argv[arg], "-m") == 0) && ((arg + 1) < argc))
+    {
+      arg++;
+      policy.InterfaceMode = (strcmp(argv[arg], "spi") == 0) ? BSP_XSPI_SPI_MODE : BSP_XSPI_QPI_MODE;
+    }
+    else if ((strcmp(argv[arg], "-P") == 0) && ((arg + 1) < argc))
+    {
+      arg++;
+      policy.PerformanceMode = (strcmp(argv[arg], "ulp") == 0) ? (int32_t)BSP_XSPI_ULTRA_LOW_POWER_MODE :
+                               (int32_t)BSP_XSPI_HIGH_PERFORMANCE_MODE;
+    }
+    else if (strcmp(argv[arg], "-g") == 0)
+    {
+      policy.KeepIdle = 1U;
+    }
+    else if ((strcmp(argv[arg], "-i") == 0) && ((arg + 1) < argc))
+    {
+      image = argv[++arg];
+    }
+    else if ((strcmp(argv[arg], "-p") == 0) && ((arg + 1) < argc))
+    {
+      timing.PageProgram = (uint32_t)strtoul(argv[++arg], NULL, 0);
+    }
+    else if ((strcmp(argv[arg], "-e") == 0) && ((arg + 1) < argc))
+    {
+      timing.SectorErase = (uint32_t)strtoul(argv[++arg], NULL, 0);
+    }
+    else if ((strcmp(argv[arg], "-b") == 0) && ((arg + 1) < argc))
+    {
+      timing.BlockErase64K = (uint32_t)strtoul(argv[++arg], NULL, 0);
+    }
+    else
+    {
+      REPLAY_Usage(argv[0]);
+      return 2;
+    }
+  }
+
+  if (arg == argc)
+  {
+    REPLAY_Usage(argv[0]);
+    return 2;
+  }
+
+  for (; arg < argc; arg++)
+  {
+    if (REPLAY_Load(argv[arg]) != 0)
+    {
+      return 1;
+    }
+  }
+
+  for (offset = 0U; offset < FLASH_MODEL_SIZE; offset++)
+  {
+    Replay_Data[offset] = (uint8_t)(offset ^ (offset >> 8));
+  }
+
+  if (FLASH_MODEL_Init(image, &timing) != FLASH_MODEL_OK)
+  {
+    (void)fprintf(stderr, "cannot load the image %s\n", image);
+    return 1;
+  }
+
+  (void)printf("%lu records, %s mode, %s performance mode, %s, tPP %luus tSE %luus tBE %luus\n",
+               (unsigned long)Replay_NbRecords, (policy.InterfaceMode == BSP_XSPI_SPI_MODE) ? "SPI" : "QPI",
+               (policy.PerformanceMode < 0) ? "recorded" :
+               ((policy.PerformanceMode == (int32_t)BSP_XSPI_ULTRA_LOW_POWER_MODE) ? "ULP" : "HP"),
+               (policy.KeepIdle != 0U) ? "recorded idle time" : "back to back",
+               (unsigned long)timing.PageProgram, (unsigned long)timing.SectorErase,
+               (unsigned long)timing.BlockErase64K);
+
+  REPLAY_Run(&policy);
+  REPLAY_Report();
+
+  FLASH_MODEL_GetStats(HOST_GetTimeNs(), &stats);
+  if (stats.Violations != 0U)
+  {
+    status = 1;
+  }
+
+  if (FLASH_MODEL_DeInit() != FLASH_MODEL_OK)
+  {
+    (void)fprintf(stderr, "cannot save the image %s\n", image);
+    status = 1;
+  }
+
+  free(Replay_Records);
+
+  return status;
+}
+
+/**
+  * @brief  Appends the records of a trace file. The file holds one or more dumps of
+  *         BSP_XSPI_DumpTrace(), each a header followed by its records.
+  * @param  pPath Trace file
+  * @retval 0 on success
+  */
+static int32_t REPLAY_Load(const char *pPath)
+{
+  FILE *file;
+  REPLAY_Record_t *records;
+  REPLAY_Record_t *record;
+  uint8_t header[REPLAY_HEADER_SIZE];
+  uint8_t data[REPLAY_RECORD_SIZE];
+  uint32_t nb_records;
+  uint32_t record_size;
+  uint32_t core_clock;
+  uint32_t version;
+  uint32_t index;
+  int32_t ret = 0;
+
+  file = fopen(pPath, "rb");
+  if (file == NULL)
+  {
+    (void)fprintf(stderr, "cannot open the trace %s\n", pPath);
+    return -1;
+  }
+
+  while ((ret == 0) && (fread(header, 1U, sizeof(header), file) == sizeof(header)))
+  {
+    version     = (uint32_t)header[4] | ((uint32_t)header[5] << 8);
+    record_size = (uint32_t)header[6] | ((uint32_t)header[7] << 8);
+    nb_records  = REPLAY_Get32(&header[8]);
+    core_clock  = REPLAY_Get32(&header[12]);
+
+    if ((REPLAY_Get32(header) != REPLAY_MAGIC) || (version == 0U) || (version > BSP_XSPI_TRACE_VERSION) ||
+        (record_size != REPLAY_RECORD_SIZE) || (core_clock == 0U))
+    {
+      (void)fprintf(stderr, "%s: not a trace of version 1 to %u\n", pPath, (unsigned)BSP_XSPI_TRACE_VERSION);
+      ret = -1;
+      break;
+    }
+
+    records = realloc(Replay_Records, (Replay_NbRecords + nb_records) * sizeof(REPLAY_Record_t));
+    if ((records == NULL) && ((Replay_NbRecords + nb_records) != 0U))
+    {
+      (void)fprintf(stderr, "out of memory\n");
+      ret = -1;
+      break;
+    }
+    Replay_Records = records;
+
+    for (index = 0U; index < nb_records; index++)
+    {
+      if (fread(data, 1U, sizeof(data), file) != sizeof(data))
+      {
+        (void)fprintf(stderr, "%s: truncated trace\n", pPath);
+        ret = -1;
+        break;
+      }
+
+      record = &Replay_Records[Replay_NbRecords];
+      (void)memset(record, 0, sizeof(REPLAY_Record_t));
+      record->Tick       = REPLAY_Get32(&data[0]);
+      record->RecordedNs = ((uint64_t)REPLAY_Get32(&data[4]) * 1000000000ULL) / core_clock;
+      record->Address    = REPLAY_Get32(&data[8]);
+      record->Size       = REPLAY_Get32(&data[12]);
+      record->Op         = (uint8_t)(data[18] & ~REPLAY_NESTED);
+      record->Nested     = ((data[18] & REPLAY_NESTED) != 0U) ? 1U : 0U;
+      record->Status     = (int8_t)data[19];
+      Replay_NbRecords++;
+    }
+  }
+
+  (void)fclose(file);
+
+  return ret;
+}
+
+/**
+  * @brief  Reads a 32-bit little endian value.
+  * @param  pData Data
+  * @retval Value
+  */
+static uint32_t REPLAY_Get32(const uint8_t *pData)
+{
+  return (uint32_t)pData[0] | ((uint32_t)pData[1] << 8) | ((uint32_t)pData[2] << 16) | ((uint32_t)pData[3] << 24);
+}
+
+/**
+  * @brief  Replays the records in their order on the virtual time base.
+  * @param  pPolicy Replay policy
+  * @retval None
+  */
+static void REPLAY_Run(const REPLAY_Policy_t *pPolicy)
+{
+  BSP_XSPI_Init_t init;
+  REPLAY_Record_t *record;
+  uint64_t start;
+  uint64_t previous_start = 0U;
+  uint64_t target;
+  uint32_t previous_tick = 0U;
+  uint32_t index;
+  int32_t idle_ms;
+
+  /* A trace starting after the init of the memory: init it first */
+  if ((Replay_NbRecords != 0U) && (Replay_Records[0].Op != (uint8_t)BSP_XSPI_TRACE_INIT))
+  {
+    init.InterfaceMode = (BSP_XSPI_Interface_t)pPolicy->InterfaceMode;
+    if (BSP_XSPI_Init(0U, &init) != BSP_ERROR_NONE)
+    {
+      (void)fprintf(stderr, "BSP_XSPI_Init failed\n");
+    }
+    if ((pPolicy->PerformanceMode >= 0) &&
+        (BSP_XSPI_SetPerformanceMode(0U, (BSP_XSPI_PerformanceMode_t)pPolicy->PerformanceMode) != BSP_ERROR_NONE))
+    {
+      (void)fprintf(stderr, "BSP_XSPI_SetPerformanceMode failed\n");
+    }
+    FLASH_MODEL_ResetStats();
+  }
+
+  for (index = 0U; index < Replay_NbRecords; index++)
+  {
+    record = &Replay_Records[index];
+
+    /* Idle time between the starts of two calls, in ms, ignored when the tick goes back */
+    if ((pPolicy->KeepIdle != 0U) && (index != 0U))
+    {
+      idle_ms = (int32_t)(record->Tick - previous_tick);
+      if (idle_ms > 0)
+      {
+        target = previous_start + (((uint64_t)idle_ms * SystemCoreClock) / 1000U);
+        if (HOST_GetCycles() < target)
+        {
+          HOST_Advance(target - HOST_GetCycles());
+        }
+      }
+    }
+    previous_tick  = record->Tick;
+    previous_start = HOST_GetCycles();
+
+    start = HOST_GetCycles();
+    record->ReplayStatus = REPLAY_Call(record, pPolicy);
+    record->ReplayedNs   = ((HOST_GetCycles() - start) * 1000000000ULL) / SystemCoreClock;
+  }
+
+  /* Program the pending data and leave the memory as at the end of an application */
+  (void)BSP_XSPI_DeInit(0U);
+}
+
+/**
+  * @brief  Calls the BSP function of a record.
+  * @param  pRecord Record, Replayed is set if the operation was replayed
+  * @param  pPolicy Replay policy
+  * @retval BSP status of the call
+  */
+static int32_t REPLAY_Call(REPLAY_Record_t *pRecord, const REPLAY_Policy_t *pPolicy)
+{
+  BSP_XSPI_Init_t init;
+  int32_t ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  uint32_t address = pRecord->Address % FLASH_MODEL_SIZE;
+  uint32_t size = (pRecord->Size > (FLASH_MODEL_SIZE - address)) ? (FLASH_MODEL_SIZE - address) : pRecord->Size;
+  uint8_t id[3];
+#if (USE_BSP_XSPI_STREAM == 1)
+  const uint8_t *span;
+  uint32_t span_size;
+  uint32_t cursor;
+#endif /* (USE_BSP_XSPI_STREAM == 1) */
+#if (USE_BSP_XSPI_CALIBRATION == 1)
+  BSP_XSPI_Calibration_t calib;
+#endif /* (USE_BSP_XSPI_CALIBRATION == 1) */
+#if (USE_BSP_XSPI_CRC == 1)
+  uint32_t crc;
+#endif /* (USE_BSP_XSPI_CRC == 1) */
+
+  pRecord->Replayed = 1U;
+
+  switch ((BSP_XSPI_TraceOp_t)pRecord->Op)
+  {
+    /* The DMA and vector reads and writes are replayed as the blocking ones */
+    case BSP_XSPI_TRACE_READ:
+    case BSP_XSPI_TRACE_READ_DMA:
+    case BSP_XSPI_TRACE_READV:
+      ret = BSP_XSPI_Read(0U, Replay_ReadData, address, size);
+      break;
+    case BSP_XSPI_TRACE_WRITE:
+    case BSP_XSPI_TRACE_WRITE_ASYNC:
+    case BSP_XSPI_TRACE_WRITEV:
+      ret = BSP_XSPI_Write(0U, &Replay_Data[address], address, size);
+      break;
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+    case BSP_XSPI_TRACE_FLUSH:
+      ret = BSP_XSPI_Flush(0U);
+      break;
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+    case BSP_XSPI_TRACE_ERASE_BLOCK:
+      ret = BSP_XSPI_Erase_Block(0U, address, (size == BSP_XSPI_BLOCK_64K) ? BSP_XSPI_ERASE_64K :
+                                 ((size == BSP_XSPI_BLOCK_32K) ? BSP_XSPI_ERASE_32K : BSP_XSPI_ERASE_4K));
+      break;
+    case BSP_XSPI_TRACE_ERASE_CHIP:
+      ret = BSP_XSPI_Erase_Chip(0U);
+      break;
+    case BSP_XSPI_TRACE_ERASE_RANGE:
+      ret = BSP_XSPI_EraseRange(0U, address, size);
+      break;
+    case BSP_XSPI_TRACE_GET_STATUS:
+      ret = BSP_XSPI_GetStatus(0U);
+      break;
+    case BSP_XSPI_TRACE_ENABLE_MMP:
+      ret = BSP_XSPI_EnableMemoryMappedMode(0U);
+      break;
+    case BSP_XSPI_TRACE_DISABLE_MMP:
+      ret = BSP_XSPI_DisableMemoryMappedMode(0U);
+      break;
+    case BSP_XSPI_TRACE_READ_ID:
+      ret = BSP_XSPI_ReadID(0U, id);
+      break;
+    case BSP_XSPI_TRACE_SUSPEND_ERASE:
+      ret = BSP_XSPI_SuspendErase(0U);
+      break;
+    case BSP_XSPI_TRACE_RESUME_ERASE:
+      ret = BSP_XSPI_ResumeErase(0U);
+      break;
+    case BSP_XSPI_TRACE_SUSPEND_PROGRAM:
+      ret = BSP_XSPI_SuspendProgram(0U);
+      break;
+    case BSP_XSPI_TRACE_RESUME_PROGRAM:
+      ret = BSP_XSPI_ResumeProgram(0U);
+      break;
+    case BSP_XSPI_TRACE_ENTER_POWER_DOWN:
+      ret = BSP_XSPI_EnterDeepPowerDown(0U);
+      break;
+    case BSP_XSPI_TRACE_LEAVE_POWER_DOWN:
+      ret = BSP_XSPI_LeaveDeepPowerDown(0U);
+      break;
+    /* The interface mode is the one of the policy */
+    case BSP_XSPI_TRACE_INIT:
+      init.InterfaceMode = (BSP_XSPI_Interface_t)pPolicy->InterfaceMode;
+      ret = BSP_XSPI_Init(0U, &init);
+      if ((ret == BSP_ERROR_NONE) && (pPolicy->PerformanceMode >= 0))
+      {
+        ret = BSP_XSPI_SetPerformanceMode(0U, (BSP_XSPI_PerformanceMode_t)pPolicy->PerformanceMode);
+      }
+      break;
+    case BSP_XSPI_TRACE_DEINIT:
+      ret = BSP_XSPI_DeInit(0U);
+      break;
+#if (USE_BSP_XSPI_STREAM == 1)
+    /* The cursors are found by their address */
+    case BSP_XSPI_TRACE_STREAM_OPEN:
+      for (cursor = 0U; (cursor < REPLAY_CURSORS_NUMBER) && (Replay_Cursors[cursor].Open != 0U); cursor++)
+      {
+      }
+      if (cursor < REPLAY_CURSORS_NUMBER)
+      {
+        ret = BSP_XSPI_StreamOpen(0U, &Replay_Cursors[cursor], address, size);
+      }
+      break;
+    case BSP_XSPI_TRACE_STREAM_NEXT:
+    case BSP_XSPI_TRACE_STREAM_CLOSE:
+      for (cursor = 0U; cursor < REPLAY_CURSORS_NUMBER; cursor++)
+      {
+        if ((Replay_Cursors[cursor].Open != 0U) && (Replay_Cursors[cursor].Address == address))
+        {
+          break;
+        }
+      }
+      if (cursor == REPLAY_CURSORS_NUMBER)
+      {
+        ret = BSP_ERROR_WRONG_PARAM;
+      }
+      else if (pRecord->Op == (uint8_t)BSP_XSPI_TRACE_STREAM_NEXT)
+      {
+        ret = BSP_XSPI_StreamNext(&Replay_Cursors[cursor], size, &span, &span_size);
+      }
+      else
+      {
+        ret = BSP_XSPI_StreamClose(&Replay_Cursors[cursor]);
+      }
+      break;
+#endif /* (USE_BSP_XSPI_STREAM == 1) */
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1) || (USE_BSP_XSPI_SCHEDULER == 1) || (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+    case BSP_XSPI_TRACE_PROCESS:
+      ret = BSP_XSPI_Process(0U);
+      break;
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) || (USE_BSP_XSPI_SCHEDULER == 1) || (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+#if (USE_BSP_XSPI_CALIBRATION == 1)
+    case BSP_XSPI_TRACE_CALIBRATE:
+      ret = BSP_XSPI_Calibrate(0U, address, &calib);
+      break;
+#endif /* (USE_BSP_XSPI_CALIBRATION == 1) */
+    /* A forced performance mode replaces the recorded switches */
+    case BSP_XSPI_TRACE_SET_PERFORMANCE_MODE:
+      if (pPolicy->PerformanceMode < 0)
+      {
+        ret = BSP_XSPI_SetPerformanceMode(0U, (BSP_XSPI_PerformanceMode_t)pRecord->Size);
+      }
+      else
+      {
+        pRecord->Replayed = 0U;
+      }
+      break;
+#if (USE_BSP_XSPI_CRC == 1)
+    case BSP_XSPI_TRACE_COMPUTE_CRC:
+      ret = BSP_XSPI_ComputeCRC(0U, address, size, &crc);
+      break;
+#endif /* (USE_BSP_XSPI_CRC == 1) */
+    /* The request type of a submit is not recorded, and no HASH unit on the host */
+    default:
+      pRecord->Replayed = 0U;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Prints the recorded and replayed latencies per operation, and the memory activity.
+  * @retval None
+  */
+static void REPLAY_Report(void)
+{
+  FLASH_MODEL_Stats_t stats;
+  uint64_t *recorded;
+  uint64_t *replayed;
+  uint64_t recorded_total = 0U;
+  uint64_t replayed_total = 0U;
+  uint32_t count;
+  uint32_t nested;
+  uint32_t differ;
+  uint32_t skipped = 0U;
+  uint32_t sector;
+  uint32_t erases;
+  uint32_t sector_erases = 0U;
+  uint32_t erased_sectors = 0U;
+  uint32_t max_erases = 0U;
+  uint32_t index;
+  uint32_t op;
+
+  recorded = malloc((Replay_NbRecords + 1U) * sizeof(uint64_t));
+  replayed = malloc((Replay_NbRecords + 1U) * sizeof(uint64_t));
+  if ((recorded == NULL) || (replayed == NULL))
+  {
+    free(recorded);
+    free(replayed);
+    return;
+  }
+
+  (void)printf("%-12s %7s %7s | %9s %9s %9s | %9s %9s %9s | %6s\n", "", "count", "nested", "rec p50", "rec p99",
+               "rec max", "p50 us", "p99 us", "max us", "status");
+
+  for (op = 0U; op < REPLAY_OPS_NUMBER; op++)
+  {
+    count  = 0U;
+    nested = 0U;
+    differ = 0U;
+    for (index = 0U; index < Replay_NbRecords; index++)
+    {
+      if ((Replay_Records[index].Op == op) && (Replay_Records[index].Replayed != 0U))
+      {
+        recorded[count] = Replay_Records[index].RecordedNs;
+        replayed[count] = Replay_Records[index].ReplayedNs;
+        recorded_total += recorded[count];
+        replayed_total += replayed[count];
+        nested += Replay_Records[index].Nested;
+        differ += (Replay_Records[index].ReplayStatus != (int32_t)Replay_Records[index].Status) ? 1U : 0U;
+        count++;
+      }
+    }
+
+    if (count != 0U)
+    {
+      qsort(recorded, count, sizeof(uint64_t), REPLAY_Compare);
+      qsort(replayed, count, sizeof(uint64_t), REPLAY_Compare);
+      (void)printf("%-12s %7lu %7lu | %9.1f %9.1f %9.1f | %9.1f %9.1f %9.1f | %6lu\n",
+                   (Replay_OpNames[op] != NULL) ? Replay_OpNames[op] : "?", (unsigned long)count,
+                   (unsigned long)nested, (double)REPLAY_Percentile(recorded, count, 500U) / 1000.0,
+                   (double)REPLAY_Percentile(recorded, count, 990U) / 1000.0, (double)recorded[count - 1U] / 1000.0,
+                   (double)REPLAY_Percentile(replayed, count, 500U) / 1000.0,
+                   (double)REPLAY_Percentile(replayed, count, 990U) / 1000.0, (double)replayed[count - 1U] / 1000.0,
+                   (unsigned long)differ);
+    }
+  }
+
+  for (index = 0U; index < Replay_NbRecords; index++)
+  {
+    skipped += (Replay_Records[index].Replayed == 0U) ? 1U : 0U;
+  }
+
+  for (sector = 0U; sector < FLASH_MODEL_SECTORS_NUMBER; sector++)
+  {
+    erases = FLASH_MODEL_GetEraseCount(sector);
+    sector_erases += erases;
+    erased_sectors += (erases != 0U) ? 1U : 0U;
+    max_erases = (erases > max_erases) ? erases : max_erases;
+  }
+
+  FLASH_MODEL_GetStats(HOST_GetTimeNs(), &stats);
+  (void)printf("total: recorded %.1f ms, replayed %.1f ms, %lu records not replayed\n",
+               (double)recorded_total / 1000000.0, (double)replayed_total / 1000000.0, (unsigned long)skipped);
+  (void)printf("memory: %lu reads, %lu programs, %lu erases, busy %.1f ms, %lu ignored commands\n",
+               (unsigned long)stats.Reads, (unsigned long)stats.Programs, (unsigned long)stats.Erases,
+               (double)stats.BusyTime / 1000000.0, (unsigned long)stats.Violations);
+  (void)printf("erases: %lu 4KB sector erases on %lu sectors, at most %lu per sector\n",
+               (unsigned long)sector_erases, (unsigned long)erased_sectors, (unsigned long)max_erases);
+
+  free(recorded);
+  free(replayed);
+}
+
+/**
+  * @brief  Compares two durations for qsort().
+  * @param  pA First duration
+  * @param  pB Second duration
+  * @retval Comparison result
+  */
+static int REPLAY_Compare(const void *pA, const void *pB)
+{
+  uint64_t a = *(const uint64_t *)pA;
+  uint64_t b = *(const uint64_t *)pB;
+
+  return (a > b) - (a < b);
+}
+
+/**
+  * @brief  Returns a percentile of sorted durations: the smallest one not exceeded by
+  *         the given part of them.
+  * @param  pSorted     Sorted durations
+  * @param  Count       Number of durations
+  * @param  PerThousand Percentile in 1/1000
+  * @retval Percentile
+  */
+static uint64_t REPLAY_Percentile(const uint64_t *pSorted, uint32_t Count, uint32_t PerThousand)
+{
+  uint64_t rank = (((uint64_t)Count * PerThousand) + 999U) / 1000U;
+
+  return pSorted[(rank == 0U) ? 0U : (rank - 1U)];
+}
+
+/**
+  * @brief  Prints the command line options.
+  * @param  pProgram Program name
+  * @retval None
+  */
+static void REPLAY_Usage(const char *pProgram)
+{
+  (void)fprintf(stderr,
+                "usage: %s [-m spi|qpi] [-P ulp|hp] [-g] [-i image] [-p tPP us] [-e tSE us] [-b tBE us]\n"
+                "       trace...\n"
+                "  -P forces the performance mode, -g keeps the recorded idle time between the calls\n",
+                pProgram);
+}
@@ -41,6 +41,48 @@ extern "C" {
 #define BSP_B2_IT_PRIORITY 0x0FUL  /* Default is lowest priority level */
 #define BSP_B3_IT_PRIORITY 0x0FUL  /* Default is lowest priority level */
 
+/* XSPI features */
+#define USE_BSP_XSPI_IT_FEATURE 0U  /* Flash ready wait done by XSPI auto-polling under interrupt */
+#define USE_BSP_XSPI_DMA_FEATURE 0U  /* DMA transfers, requires USE_BSP_XSPI_IT_FEATURE */
+#define USE_BSP_XSPI_READ_CACHE 0U  /* RAM cache of memory lines in front of BSP_XSPI_Read() */
+#define USE_BSP_XSPI_WRITE_COMBINE 0U  /* Small BSP_XSPI_Write() calls gathered in a RAM page image */
+#define USE_BSP_XSPI_BLANK_CHECK 0U  /* Erase of already blank blocks skipped by BSP_XSPI_Erase_Block() */
+#define USE_BSP_XSPI_WRITE_VERIFY 0U  /* Each programmed page read back and compared with the source */
+#define USE_BSP_XSPI_SCHEDULER 0U  /* Prioritized request queue run by BSP_XSPI_Process() */
+#define USE_BSP_XSPI_BENCHMARK 0U  /* Throughput measure functions, use the DWT cycle counter */
+#define USE_BSP_XSPI_CALIBRATION 0U  /* XSPI timing calibration with BSP_XSPI_Calibrate() */
+#define USE_BSP_XSPI_MMP_ARBITRATION 0U  /* Read, write, erase and status functions usable in memory-mapped mode */
+#define USE_BSP_XSPI_AUTO_POWER_DOWN 0U  /* Deep power-down after an idle time, wake-up on the next access */
+#define USE_BSP_XSPI_WARM_INIT 0U  /* BSP_XSPI_Init() fast path with the context saved before a low-power mode */
+#define USE_BSP_XSPI_ICACHE 0U  /* Memory-mapped window cached through an ICACHE remap region */
+#define USE_BSP_XSPI_VECTOR_IO 0U  /* Scatter-gather BSP_XSPI_ReadV() and BSP_XSPI_WriteV() */
+#define USE_BSP_XSPI_STREAM 0U  /* Cursors reading in place through the memory-mapped window */
+#define USE_BSP_XSPI_CRC 0U  /* CRC (and HASH) of memory areas read through the memory-mapped window */
+#define USE_BSP_XSPI_STATS 0U  /* Per-operation cycle statistics, use the DWT cycle counter */
+#define USE_BSP_XSPI_TRACE 0U  /* Ring of the BSP calls, dumpable on the COM port */
+
+/* XSPI read cache geometry: RAM budget is BSP_XSPI_CACHE_LINE_SIZE x BSP_XSPI_CACHE_LINES_NBR */
+#define BSP_XSPI_CACHE_LINE_SIZE 4096U  /* Power of two, default is one 4KB sector */
+#define BSP_XSPI_CACHE_LINES_NBR 2U
+
+/* XSPI write combining: age in ms after which BSP_XSPI_Process() programs a pending page */
+#define BSP_XSPI_WRITE_COMBINE_TIMEOUT 100U
+
+/* XSPI scheduler: queued requests and suspends allowed to serve reads, per erase and per page program */
+#define BSP_XSPI_QUEUE_DEPTH 8U
+#define BSP_XSPI_MAX_ERASE_SUSPEND 8U
+#define BSP_XSPI_MAX_PROGRAM_SUSPEND 2U
+
+/* XSPI automatic deep power-down: time without access in ms */
+#define BSP_XSPI_POWER_DOWN_TIMEOUT 10U
+
+/* XSPI clock prescalers used by BSP_XSPI_SetPerformanceMode(), for a 100 MHz XSPI kernel clock */
+#define BSP_XSPI_ULP_PRESCALER 2U  /* 33 MHz in ultra low power mode */
+#define BSP_XSPI_HP_PRESCALER 1U  /* 50 MHz in high performance mode */
+
+/* XSPI interrupt priority */
+#define BSP_XSPI_IT_PRIORITY 0x0FUL  /* Default is lowest priority level */
+
 #ifdef __cplusplus
 }
 #endif
@@ -42,6 +42,7 @@ extern "C" {
 #define BSP_ERROR_XSPI_SUSPENDED             -20
 #define BSP_ERROR_XSPI_MMP_LOCK_FAILURE      -21
 #define BSP_ERROR_XSPI_MMP_UNLOCK_FAILURE    -22
+#define BSP_ERROR_XSPI_VERIFY_FAILURE        -23
 
 #ifdef __cplusplus
 }
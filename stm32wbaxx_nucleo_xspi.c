@@ -39,14 +39,16 @@
             (see the XSPI memory data sheet)
        (++) Perform erase block operation using the function BSP_XSPI_Erase_Block() and by
             specifying the block address. You can perform an erase operation of the whole
-            chip by calling the function BSP_XSPI_Erase_Chip().
+            chip by calling the function BSP_XSPI_Erase_Chip(). BSP_XSPI_EraseRange() erases a
+            4KB aligned area with the largest blocks (64KB, 32KB then 4KB) fitting in it.
        (++) The function BSP_XSPI_GetStatus() returns the current status of the XSPI memory.
             (see the XSPI memory data sheet)
        (++) The memory access can be configured in memory-mapped mode with the call of
             function BSP_XSPI_EnableMemoryMapped(). To go back in indirect mode, the
             function BSP_XSPI_DisableMemoryMapped() should be used.
        (++) The erase operation can be suspend and resume with using functions
-            BSP_XSPI_SuspendErase() and BSP_XSPI_ResumeErase()
+            BSP_XSPI_SuspendErase() and BSP_XSPI_ResumeErase(), and the program operation
+            with BSP_XSPI_SuspendProgram() and BSP_XSPI_ResumeProgram()
        (++) It is possible to put the memory in deep power-down mode to reduce its consumption.
             For this, the function BSP_XSPI_EnterDeepPowerDown() should be called. To leave
             the deep power-down mode, the function BSP_XSPI_LeaveDeepPowerDown() should be called.
@@ -56,6 +58,146 @@
             the function XSPI_ConfigFlash(), two modes are possible :
             - SPI : instruction, address and data on one line
             - QPI : instruction on one line while address and data on four lines with sampling on one edge of clock
+       (++) The read command used by BSP_XSPI_Read() and the memory-mapped mode is selected with
+            the ReadCommand and DummyCycles fields of BSP_XSPI_InitEx_t, given to BSP_XSPI_InitEx()
+            instead of BSP_XSPI_Init(): FAST_READ, DREAD, 2READ, or QREAD and 4READ which need
+            the QPI mode. BSP_XSPI_READ_DEFAULT and 0 dummy cycles keep the command of the
+            interface mode (see stm32wbaxx_nucleo_xspi.h for the fastest command for each clock
+            prescaler). In the same way, the ProgramCommand field selects the page program
+            command used by the write functions: PP, or 4PP which needs the QPI mode.
+            BSP_XSPI_Init() uses the commands of the interface mode.
+       (++) BSP_XSPI_EnableMemoryMappedModeEx() with BSP_XSPI_MMP_CONTINUOUS_READ keeps the
+            memory in the 4READ performance enhance mode: the opcode is skipped in the line
+            fills after the first one, which lowers the execute-in-place latency. It needs
+            the QPI mode with the 4READ command. The memory leaves this mode when the
+            memory-mapped mode is disabled.
+       (++) With USE_BSP_XSPI_AUTO_POWER_DOWN, BSP_XSPI_Process() puts the memory in deep
+            power-down once it has not been accessed for BSP_XSPI_POWER_DOWN_TIMEOUT ms and no
+            operation is on-going or pending, except in memory-mapped mode. The next BSP
+            function accessing the memory wakes it up and waits for its wake-up time first.
+            BSP_XSPI_GetPowerStats() returns the time spent awake and in deep power-down.
+       (++) With USE_BSP_XSPI_WARM_INIT, BSP_XSPI_SaveContext() called before a low-power mode
+            makes the next BSP_XSPI_Init() restore the saved XSPI timing and memory mode, and
+            check the memory identification, status and configuration registers instead of
+            resetting and configuring it. The full init is done if the memory state does not
+            match. The sequence is BSP_XSPI_SaveContext(), BSP_XSPI_DeInit(), low-power mode
+            retaining the SRAM, then BSP_XSPI_Init() with the same interface mode.
+       (++) With USE_BSP_XSPI_ICACHE, the memory-mapped mode also maps the XSPI window on an
+            ICACHE remap region in the code area (BSP_XSPI_ICACHE_BASE by default, set with
+            BSP_XSPI_ConfigICache()): code and constants accessed through this alias are
+            cached. The ICACHE is invalidated by the BSP functions changing the memory, and
+            the region is removed when the memory-mapped mode is disabled. The ICACHE itself
+            is enabled by the application: the BSP leaves it enabled or disabled as found.
+            BSP_XSPI_BenchmarkICache() compares the read time with and without the ICACHE.
+       (++) With USE_BSP_XSPI_VECTOR_IO, BSP_XSPI_ReadV() and BSP_XSPI_WriteV() read and write
+            a list of BSP_XSPI_IoVec_t buffers at consecutive memory addresses, with no copy in
+            an intermediate buffer. Each buffer goes through the read path of BSP_XSPI_Read(),
+            and the buffers sharing a page are sent with a single page program. Each call is
+            measured and traced as one read or write of the total size.
+       (++) With USE_BSP_XSPI_STREAM, BSP_XSPI_StreamOpen() opens a cursor on a memory area,
+            BSP_XSPI_StreamNext() returns the next span of the area as a pointer in the
+            memory-mapped window, to be processed in place with no copy in RAM, and
+            BSP_XSPI_StreamClose() closes it. The memory-mapped mode is held while cursors are
+            open: the functions which would leave it return BSP_ERROR_BUSY.
+       (++) With USE_BSP_XSPI_CRC, BSP_XSPI_ComputeCRC() computes the CRC-32 (IEEE 802.3) of a
+            memory area with the CRC unit, fed straight from the memory-mapped window with no
+            intermediate buffer. When the HAL HASH module is enabled, BSP_XSPI_ComputeHash()
+            computes its SHA-256 digest the same way with the HASH unit. The memory-mapped mode
+            is enabled for the computation if needed. The CRC unit is fed by words, and its
+            configuration is restored afterwards. BSP_XSPI_BenchmarkCRC() measures their
+            throughput in the benchmark build.
+       (++) With USE_BSP_XSPI_STATS, the read, write, erase and flush functions are timed with
+            the DWT cycle counter. BSP_XSPI_GetStats() returns for each operation type the
+            number of calls, bytes, total, minimum and maximum cycles and a log2 histogram of
+            the cycles, with the status polls and their timeouts. An erase is timed from its
+            command to the end seen by a status poll or BSP_XSPI_GetStatus(), suspends
+            included, and BSP_XSPI_WriteAsync() and BSP_XSPI_ReadDMA() up to their completion.
+            With write combining, BSP_XSPI_Write() times the copy in the page image, and each
+            program of the page image is also accounted in the flush operation, whichever
+            function needs it. Nothing is compiled when the option is 0.
+       (++) With USE_BSP_XSPI_TRACE, the init, read, write, erase, status, memory-mapped,
+            stream, scheduler, suspend, resume, power-down, calibration, performance mode and
+            CRC/hash functions write a BSP_XSPI_TraceRecord_t in a ring of
+            BSP_XSPI_TRACE_DEPTH records: operation, address, size, start tick, duration in
+            CPU cycles and status. The calls made by the BSP functions are part of the record
+            of the outermost one. A BSP_XSPI_GetStatus() poll returning the status of the
+            previous record and a BSP_XSPI_Process() call with nothing to do are not
+            recorded. The nesting is tracked apart for the thread mode and the
+            interrupt handlers: a call from an interrupt handler is recorded on its own, with
+            BSP_XSPI_TRACE_NESTED set in its operation if it interrupted a recorded call.
+            BSP_XSPI_GetTrace() returns the records and BSP_XSPI_DumpTrace() sends them on a
+            COM port in binary, after a BSP_XSPI_TraceHeader_t, to record the access patterns
+            of an application. They can be replayed by host/build/xspi_replay.
+       (++) With USE_BSP_XSPI_WRITE_VERIFY, each page is read back right after its program
+            completes, by chunks of BSP_XSPI_VERIFY_CHUNK bytes, and compared with the source
+            data. A mismatch ends the write with BSP_ERROR_XSPI_VERIFY_FAILURE.
+       (++) With USE_BSP_XSPI_MMP_ARBITRATION, the memory-mapped mode no longer locks the
+            instance: BSP_XSPI_Read() copies from the memory-mapped window, while the write,
+            erase and status functions leave the memory-mapped mode, run their commands and
+            enter it again. While an erase or a program is on-going or suspended, the window
+            cannot be read: the XSPI stays in indirect mode and BSP_XSPI_Read() reads in
+            indirect mode. The memory-mapped mode is entered again by BSP_XSPI_GetStatus(),
+            BSP_XSPI_Read() or BSP_XSPI_Process() once the memory is ready, so the window must
+            not be read before BSP_XSPI_GetStatus() returns BSP_ERROR_NONE after an erase.
+       (++) BSP_XSPI_SetPerformanceMode() switches the memory between its ultra low power mode
+            (power-on default) and its high performance mode, and sets the XSPI clock to the
+            fastest one of the mode.
+       (++) With USE_BSP_XSPI_CALIBRATION, BSP_XSPI_Calibrate() looks for the fastest reliable
+            clock prescaler, sample shifting, delay hold and delay block phase by reading back
+            a pattern written in a reserved 4KB sector, and applies it. Each delay cell of the
+            clock period measured by the delay block is tried. The delay hold is not a field of
+            MX_XSPI_InitTypeDef: it is set over the MX_XSPI_Init() settings. The returned
+            settings can be stored and applied at the next boot with BSP_XSPI_ApplyCalibration(),
+            which checks them.
+       (++) With USE_BSP_XSPI_BENCHMARK, BSP_XSPI_BenchmarkProgram() measures the program
+            throughput with PP and 4PP for a list of clock prescalers, in a reserved 4KB sector.
+            BSP_XSPI_BenchmarkWorkload() runs a sequential read, random read, small write or
+            mixed workload on a reserved area through the BSP functions, and returns the
+            operations and bytes per second and the maximum and 99th percentile latencies,
+            to compare the cache, write combining and erase options on the board.
+       (++) When USE_BSP_XSPI_IT_FEATURE is set to 1 in stm32wbaxx_nucleo_conf.h, the wait for the
+            end of program/erase operations is delegated to the XSPI status-match auto-polling and
+            the core sleeps until the match interrupt. BSP_XSPI_IRQHandler() must then be called
+            from the XSPI1_IRQHandler() of the application.
+       (++) With USE_BSP_XSPI_IT_FEATURE, BSP_XSPI_WriteAsync() starts a write and returns
+            immediately. The write enable, page program and wait for end of program steps
+            of each page are chained under interrupt, and BSP_XSPI_WriteCpltCallback() is
+            called with the final BSP status once the last page is programmed. No step
+            waits under interrupt. The other functions of the instance return
+            BSP_ERROR_BUSY meanwhile, and abort a write running past its deadline.
+       (++) With USE_BSP_XSPI_DMA_FEATURE (which requires USE_BSP_XSPI_IT_FEATURE),
+            BSP_XSPI_ReadDMA() reads the memory through the GPDMA and notifies the end of
+            the transfer with BSP_XSPI_ReadCpltCallback(). Reads longer than
+            BSP_XSPI_DMA_MAX_TRANSFER are split in several DMA transfers chained under
+            interrupt. The data phase of BSP_XSPI_WriteAsync() also uses the DMA.
+            BSP_XSPI_DMA_RX_IRQHandler() and BSP_XSPI_DMA_TX_IRQHandler() must be called from
+            the GPDMA channels interrupt handlers of the application.
+       (++) With USE_BSP_XSPI_READ_CACHE, BSP_XSPI_Read() is served from a RAM cache of
+            BSP_XSPI_CACHE_LINES_NBR lines of BSP_XSPI_CACHE_LINE_SIZE bytes with LRU
+            replacement. Reads larger than the whole cache bypass it. The lines are updated
+            by BSP_XSPI_Write() and invalidated by the erase functions and by
+            BSP_XSPI_WriteAsync(). The lines of an area being erased are not filled until
+            the end of the erase is read in the memory status, so that the data read while
+            the erase is on-going or suspended is never kept. Hit/miss counters are
+            returned by BSP_XSPI_GetCacheStats().
+       (++) With USE_BSP_XSPI_WRITE_COMBINE, the data of BSP_XSPI_Write() calls smaller than a
+            page are merged in a RAM page image, which is programmed once: when a write
+            targets another page or reaches the end of the page, when BSP_XSPI_Flush() is
+            called, when BSP_XSPI_Process() finds it older than BSP_XSPI_WRITE_COMBINE_TIMEOUT,
+            and before any read, erase or memory-mapped access which could see it.
+            BSP_XSPI_Process() should be called periodically by the application.
+       (++) With USE_BSP_XSPI_BLANK_CHECK, BSP_XSPI_Erase_Block() (and so BSP_XSPI_EraseRange())
+            first reads the block and skips the erase when it is already blank. The numbers
+            of performed and skipped erases are returned by BSP_XSPI_GetEraseStats().
+       (++) With USE_BSP_XSPI_SCHEDULER, read, program and erase requests are queued with
+            BSP_XSPI_Submit() and executed by BSP_XSPI_Process() by priority order, one step
+            per call: a read, the start or end of a page program, or the start or end of an
+            erase. Reads are served between the pages of a program. While an erase or a page
+            program is on-going, pending reads suspend it, are served and the operation is
+            resumed, up to BSP_XSPI_MAX_ERASE_SUSPEND times per erase and
+            BSP_XSPI_MAX_PROGRAM_SUSPEND times per page program. The end of each request is
+            notified by BSP_XSPI_RequestCpltCallback(). The request structures must remain
+            valid until their completion callback.
 
   @endverbatim
   ******************************************************************************
@@ -63,6 +205,11 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32wbaxx_nucleo_xspi.h"
+#if (USE_BSP_XSPI_READ_CACHE == 1) || (USE_BSP_XSPI_WRITE_COMBINE == 1) || (USE_BSP_XSPI_MMP_ARBITRATION == 1) || \
+    (USE_BSP_XSPI_STATS == 1)
+#include <string.h>
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) || (USE_BSP_XSPI_WRITE_COMBINE == 1) || (USE_BSP_XSPI_MMP_ARBITRATION == 1) ||
+          (USE_BSP_XSPI_STATS == 1) */
 
 /** @addtogroup BSP
   * @{
@@ -85,7 +232,12 @@ XSPI_Ctx_t Xspi_Ctx[XSPI_INSTANCES_NUMBER] =
 {
   {
     XSPI_ACCESS_NONE,
-    MX25R3235F_SPI_MODE
+    MX25R3235F_SPI_MODE,
+    BSP_XSPI_READ_DEFAULT,
+    0U,
+    BSP_XSPI_PROGRAM_DEFAULT,
+    BSP_XSPI_ULTRA_LOW_POWER_MODE,
+    BSP_XSPI_MMP_DEFAULT
   }
 };
 /**
@@ -93,7 +245,190 @@ XSPI_Ctx_t Xspi_Ctx[XSPI_INSTANCES_NUMBER] =
   */
 
 
+/* Private typedef -----------------------------------------------------------*/
+/** @defgroup STM32WBAXX_NUCLEO_XSPI_Private_Types STM32WBAXX_NUCLEO XSPI Private Types
+  * @{
+  */
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+typedef enum
+{
+  XSPI_ASYNC_IDLE = 0U,          /*!<  No asynchronous operation                 */
+  XSPI_ASYNC_WAIT_READY,         /*!<  Waiting for the end of the previous step  */
+  XSPI_ASYNC_WRITE_ENABLE,       /*!<  Write enable command on-going             */
+  XSPI_ASYNC_PROGRAM,            /*!<  Page program data transfer on-going       */
+  XSPI_ASYNC_READ                /*!<  Read data transfer on-going               */
+} XSPI_AsyncState_t;
+
+typedef struct
+{
+  __IO XSPI_AsyncState_t State;    /*!<  Current step of the operation   */
+  const uint8_t          *pData;   /*!<  Next data to transfer           */
+  uint8_t                *pRxData; /*!<  Next data to receive            */
+  uint32_t               Address;  /*!<  Next memory address            */
+  uint32_t               EndAddress; /*!< End of the operation           */
+  uint32_t               Size;     /*!<  Size of the current transfer    */
+  uint32_t               StartTick; /*!< Tick of the operation start     */
+  uint32_t               Timeout;  /*!<  Deadline of the operation in ms */
+} XSPI_AsyncCtx_t;
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+typedef struct
+{
+  uint32_t               Address;  /*!<  Memory address of the line          */
+  uint32_t               Age;      /*!<  Last access stamp for LRU           */
+  uint32_t               Valid;    /*!<  Line content is valid               */
+} XSPI_CacheLine_t;
+
+typedef struct
+{
+  uint32_t               Pending;  /*!<  Erase issued and not yet seen complete */
+  uint32_t               Start;    /*!<  Start address of the erased area       */
+  uint32_t               End;      /*!<  End address of the erased area         */
+} XSPI_CacheErase_t;
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+typedef struct
+{
+  uint32_t               Data[MX25R3235F_PAGE_SIZE / 4U];  /*!<  Page image, erased bytes are 0xFF   */
+  uint32_t               Address;  /*!<  Memory address of the page          */
+  uint32_t               Start;    /*!<  Offset of the first pending byte    */
+  uint32_t               End;      /*!<  Offset following the last one       */
+  uint32_t               Tick;     /*!<  HAL tick of the first pending write */
+  uint32_t               Pending;  /*!<  Page image holds unprogrammed data  */
+} XSPI_WriteCombine_t;
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+
+#if (USE_BSP_XSPI_SCHEDULER == 1)
+typedef struct
+{
+  BSP_XSPI_Request_t    *Queue[BSP_XSPI_QUEUE_DEPTH];  /*!<  Pending requests, in submission order */
+  uint32_t               Count;     /*!<  Number of pending requests          */
+  BSP_XSPI_Request_t    *pBusy;     /*!<  Erase or page program on-going in the memory */
+  uint32_t               Suspends;  /*!<  Suspends of the on-going operation  */
+  BSP_XSPI_Request_t    *pProgram;  /*!<  Program executed page by page       */
+  uint32_t               Offset;    /*!<  Bytes of pProgram already written   */
+  uint32_t               PageSize;  /*!<  Bytes of the on-going page program  */
+} XSPI_Scheduler_t;
+#endif /* (USE_BSP_XSPI_SCHEDULER == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+typedef struct
+{
+  uint32_t               PowerDown;  /*!<  1 when the memory is in deep power-down    */
+  uint32_t               LastAccess; /*!<  Tick of the last access to the memory       */
+  uint32_t               StateTick;  /*!<  Tick of the last power state change         */
+  BSP_XSPI_PowerStats_t  Stats;      /*!<  Time in each state up to StateTick          */
+} XSPI_Power_t;
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+#if (USE_BSP_XSPI_WARM_INIT == 1)
+typedef struct
+{
+  uint32_t                   Valid;           /*!<  1 when saved and not yet used by a warm init */
+  BSP_XSPI_Interface_t       InterfaceMode;   /*!<  Flash Interface mode                         */
+  BSP_XSPI_PerformanceMode_t PerformanceMode; /*!<  Power mode of the memory                     */
+  BSP_XSPI_Calibration_t     Timing;          /*!<  XSPI timing settings                         */
+} XSPI_SavedCtx_t;
+#endif /* (USE_BSP_XSPI_WARM_INIT == 1) */
+#if (USE_BSP_XSPI_STREAM == 1)
+typedef struct
+{
+  uint32_t               Holds;     /*!<  Open cursors                                        */
+  uint32_t               MmpOwner;  /*!<  1 when the memory-mapped mode was entered for them  */
+} XSPI_Stream_t;
+#endif /* (USE_BSP_XSPI_STREAM == 1) */
+#if (USE_BSP_XSPI_STATS == 1)
+typedef struct
+{
+  BSP_XSPI_Stats_t       Stats;        /*!<  Statistics returned by BSP_XSPI_GetStats()     */
+  uint32_t               Depth;        /*!<  Nesting of the measured BSP functions          */
+  uint32_t               StartCycles;  /*!<  Cycle counter at the start of the outermost one */
+  uint32_t               StartPolls;   /*!<  Status polls at the start of the outermost one  */
+  uint32_t               EraseOpen;    /*!<  1 while an erase is measured up to its end      */
+  uint32_t               EraseSuspended; /*!< 1 while the measured erase is suspended       */
+  uint32_t               EraseSize;    /*!<  Bytes of the measured erase                     */
+  uint32_t               EraseCycles;  /*!<  Cycle counter at the erase command              */
+  uint32_t               EraseTick;    /*!<  HAL tick at the erase command                   */
+  uint32_t               AsyncCycles;  /*!<  Cycle counter at the start of the async operation */
+  uint32_t               AsyncSize;    /*!<  Bytes of the async operation                    */
+} XSPI_Stats_t;
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+/* Nesting contexts of the trace: thread mode and interrupt handlers */
+#define XSPI_TRACE_THREAD             0U
+#define XSPI_TRACE_HANDLER            1U
+#define XSPI_TRACE_CONTEXTS           2U
+
+typedef struct
+{
+  BSP_XSPI_TraceRecord_t Records[BSP_XSPI_TRACE_DEPTH]; /*!<  Trace ring                      */
+  uint32_t               Count;        /*!<  Records written since the reset                */
+  uint32_t               Depth[XSPI_TRACE_CONTEXTS];       /*!<  Nesting of the recorded BSP functions */
+  uint32_t               StartTick[XSPI_TRACE_CONTEXTS];   /*!<  Tick at the start of the outermost one */
+  uint32_t               StartCycles[XSPI_TRACE_CONTEXTS]; /*!<  Cycle counter at its start            */
+} XSPI_Trace_t;
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+/**
+  * @}
+  */
+
 /* Private constants --------------------------------------------------------*/
+/** @defgroup STM32WBAXX_NUCLEO_XSPI_Private_Constants STM32WBAXX_NUCLEO XSPI Private Constants
+  * @{
+  */
+#define XSPI_NOR_CMD_RDSR             0x05U   /* Read Status Register */
+#define XSPI_NOR_CMD_RDCR             0x15U   /* Read Configuration Register */
+#define XSPI_NOR_CMD_WRSR             0x01U   /* Write Status and Configuration Registers */
+#define XSPI_NOR_CMD_WREN             0x06U   /* Write Enable */
+#define XSPI_NOR_CMD_PP               0x02U   /* Page Program 1-1-1 */
+#define XSPI_NOR_CMD_4PP              0x38U   /* Quad Page Program 1-4-4 */
+#define XSPI_NOR_CMD_FAST_READ        0x0BU   /* Fast Read 1-1-1 */
+#define XSPI_NOR_CMD_DREAD            0x3BU   /* Dual Output Read 1-1-2 */
+#define XSPI_NOR_CMD_2READ            0xBBU   /* Dual I/O Read 1-2-2 */
+#define XSPI_NOR_CMD_QREAD            0x6BU   /* Quad Output Read 1-1-4 */
+#define XSPI_NOR_CMD_4READ            0xEBU   /* Quad I/O Read 1-4-4 */
+
+#define XSPI_NOR_DUMMY_FAST_READ      8U      /* Dummy cycles of FAST_READ */
+#define XSPI_NOR_DUMMY_DREAD          8U      /* Dummy cycles of DREAD */
+#define XSPI_NOR_DUMMY_2READ          4U      /* Dummy cycles of 2READ */
+#define XSPI_NOR_DUMMY_QREAD          8U      /* Dummy cycles of QREAD */
+#define XSPI_NOR_DUMMY_4READ          4U      /* Dummy cycles of 4READ after the mode bits */
+#define XSPI_NOR_DUMMY_MODE_BITS      2U      /* Cycles of the 4READ mode bits */
+#define XSPI_NOR_DUMMY_MAX            31U     /* Largest dummy cycles count of the XSPI */
+#define XSPI_NOR_MODE_NO_PE           0xAAU   /* 4READ mode bits: no performance enhance */
+#define XSPI_NOR_MODE_PE              0xA5U   /* 4READ mode bits: performance enhance, next opcode skipped */
+#define XSPI_NOR_MODE_PE_EXIT         0xFFU   /* 4READ mode bits: exit of performance enhance */
+
+#define XSPI_NOR_CR2_LH_SWITCH        0x02U   /* Configuration register 2 bit: high performance mode */
+
+#define XSPI_NOR_ID_MANUFACTURER      0xC2U   /* RDID byte 1: Macronix */
+#define XSPI_NOR_ID_TYPE              0x28U   /* RDID byte 2: memory type */
+#define XSPI_NOR_ID_DENSITY           0x16U   /* RDID byte 3: 32 Mbit */
+
+#define XSPI_AUTOPOLLING_INTERVAL     0x10U   /* Clock cycles between two status reads */
+#define XSPI_DLYB_PHASE_NBR           12U     /* Output clock phases of the delay block */
+#define XSPI_PRESCALER_MAX            255U    /* Largest XSPI clock prescaler */
+#define XSPI_ASYNC_CMD_TIMEOUT        0U      /* Commands issued under interrupt: no wait for the XSPI */
+#define XSPI_ASYNC_PAGE_TIMEOUT       20U     /* Deadline per page of BSP_XSPI_WriteAsync() in ms, above tPP max */
+
+#define XSPI_NOR_DP_WAKE_US           35U     /* Deep power-down exit time: 30 us min, with margin */
+
+#define XSPI_ICACHE_BENCH_LOOPS       4U      /* Reads of the area per ICACHE benchmark measure */
+
+#define XSPI_BENCH_READ_SIZE          MX25R3235F_PAGE_SIZE /* Bytes per read of the workload benchmark */
+#define XSPI_BENCH_WRITE_SIZE         16U     /* Bytes per write of the workload benchmark */
+#define XSPI_BENCH_MIXED_WRITES       77U     /* Writes per 256 operations of the mixed workload (30%) */
+#define XSPI_BENCH_SUB_BINS           8U      /* Latency histogram bins per power of two of CPU cycles */
+#define XSPI_BENCH_BINS               240U    /* Latency histogram bins, up to 2^32 - 1 cycles */
+#define XSPI_TRACE_COM_TIMEOUT        1000U   /* COM transmit timeout of the trace dump in ms */
+#define XSPI_HASH_TIMEOUT             1000U   /* HASH computation timeout in ms, plus the time of the data */
+#define XSPI_HASH_BYTES_PER_MS        1024U   /* Slowest memory-mapped read rate for the timeout: 1 line at 8 MHz */
+
+#define XSPI_BENCH_SEED               0x12345678U /* Seed of the workload random generator */
+/**
+  * @}
+  */
+
 /* Private variables ---------------------------------------------------------*/
 /** @defgroup STM32WBAXX_NUCLEO_XSPI_Private_Variables STM32WBAXX_NUCLEO XSPI Private Variables
   * @{
@@ -101,6 +436,63 @@ XSPI_Ctx_t Xspi_Ctx[XSPI_INSTANCES_NUMBER] =
 #if (USE_HAL_XSPI_REGISTER_CALLBACKS == 1)
 static uint32_t Xspi_IsMspCbValid[XSPI_INSTANCES_NUMBER] = {0};
 #endif /* USE_HAL_XSPI_REGISTER_CALLBACKS */
+static uint32_t Xspi_ProgramSuspended[XSPI_INSTANCES_NUMBER];
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+static __IO int32_t Xspi_PollStatus[XSPI_INSTANCES_NUMBER] = {BSP_ERROR_NONE};
+static XSPI_AsyncCtx_t Xspi_Async[XSPI_INSTANCES_NUMBER];
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+static XSPI_CacheLine_t      Xspi_CacheLines[XSPI_INSTANCES_NUMBER][BSP_XSPI_CACHE_LINES_NBR];
+static uint32_t              Xspi_CacheData[XSPI_INSTANCES_NUMBER][BSP_XSPI_CACHE_LINES_NBR]
+                                           [BSP_XSPI_CACHE_LINE_SIZE / 4U];
+static uint32_t              Xspi_CacheClock[XSPI_INSTANCES_NUMBER];
+static BSP_XSPI_CacheStats_t Xspi_CacheStats[XSPI_INSTANCES_NUMBER];
+static XSPI_CacheErase_t     Xspi_CacheErase[XSPI_INSTANCES_NUMBER];
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+#if (USE_BSP_XSPI_BLANK_CHECK == 1)
+static BSP_XSPI_EraseStats_t Xspi_EraseStats[XSPI_INSTANCES_NUMBER];
+#endif /* (USE_BSP_XSPI_BLANK_CHECK == 1) */
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+static XSPI_WriteCombine_t   Xspi_WriteCombine[XSPI_INSTANCES_NUMBER];
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+#if (USE_BSP_XSPI_SCHEDULER == 1)
+static XSPI_Scheduler_t      Xspi_Scheduler[XSPI_INSTANCES_NUMBER];
+#endif /* (USE_BSP_XSPI_SCHEDULER == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+static XSPI_Power_t          Xspi_Power[XSPI_INSTANCES_NUMBER];
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+#if (USE_BSP_XSPI_WARM_INIT == 1)
+static XSPI_SavedCtx_t       Xspi_SavedCtx[XSPI_INSTANCES_NUMBER];
+#endif /* (USE_BSP_XSPI_WARM_INIT == 1) */
+#if (USE_BSP_XSPI_STREAM == 1)
+static XSPI_Stream_t         Xspi_Stream[XSPI_INSTANCES_NUMBER];
+#endif /* (USE_BSP_XSPI_STREAM == 1) */
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+/* 1 when the memory-mapped mode is left for an erase or a program and not yet entered again */
+static uint32_t              Xspi_MmpLeft[XSPI_INSTANCES_NUMBER];
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+#if (USE_BSP_XSPI_STATS == 1)
+static XSPI_Stats_t          Xspi_Stats[XSPI_INSTANCES_NUMBER];
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+static XSPI_Trace_t          Xspi_Trace[XSPI_INSTANCES_NUMBER];
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+#if (USE_BSP_XSPI_ICACHE == 1)
+static BSP_XSPI_ICacheConfig_t Xspi_ICacheConfig[XSPI_INSTANCES_NUMBER] =
+{
+  {BSP_XSPI_ICACHE_BASE, BSP_XSPI_ICACHE_REGION_SIZE, BSP_XSPI_ICACHE_BURST}
+};
+#endif /* (USE_BSP_XSPI_ICACHE == 1) */
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+static DMA_HandleTypeDef hdma_xspi_rx;
+static DMA_HandleTypeDef hdma_xspi_tx;
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+#if (USE_BSP_XSPI_CRC == 1)
+static CRC_HandleTypeDef hcrc_xspi;
+#if defined(HAL_HASH_MODULE_ENABLED)
+static HASH_HandleTypeDef hhash_xspi;
+#endif /* defined(HAL_HASH_MODULE_ENABLED) */
+#endif /* (USE_BSP_XSPI_CRC == 1) */
 /**
   * @}
   */
@@ -112,12 +504,155 @@ static uint32_t Xspi_IsMspCbValid[XSPI_INSTANCES_NUMBER] = {0};
   */
 static void    XSPI_MspInit(XSPI_HandleTypeDef *hxspi);
 static void    XSPI_MspDeInit(XSPI_HandleTypeDef *hxspi);
+static int32_t XSPI_CheckCommands(const BSP_XSPI_InitEx_t *Init);
 static int32_t XSPI_ResetMemory(uint32_t Instance);
 static int32_t XSPI_EnterQPIMode(uint32_t Instance);
 static int32_t XSPI_ExitQPIMode(uint32_t Instance);
+static int32_t XSPI_ReadConfigRegister(uint32_t Instance, uint8_t *pReg);
+static int32_t XSPI_SetPowerMode(uint32_t Instance, BSP_XSPI_PerformanceMode_t Mode);
 static void    XSPI_DLYB_Enable(uint32_t Instance);
-static int32_t XSPI_AutoPollingMemReady(XSPI_HandleTypeDef *hxspi);
+static int32_t XSPI_AutoPollingMemReady(uint32_t Instance, uint32_t Timeout);
+static int32_t XSPI_PollingMemReady(uint32_t Instance, uint32_t Timeout);
 static int32_t XSPI_ConfigFlash(uint32_t Instance, BSP_XSPI_Interface_t Mode);
+static int32_t XSPI_ReadMemory(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size);
+static int32_t XSPI_WriteData(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size);
+#if (USE_BSP_XSPI_VECTOR_IO == 1)
+static uint32_t XSPI_VectorSize(const BSP_XSPI_IoVec_t *pVec, uint32_t NbVec);
+static int32_t XSPI_ReadVector(uint32_t Instance, const BSP_XSPI_IoVec_t *pVec, uint32_t NbVec, uint32_t ReadAddr);
+static int32_t XSPI_WriteVector(uint32_t Instance, const BSP_XSPI_IoVec_t *pVec, uint32_t NbVec, uint32_t WriteAddr);
+#if (USE_BSP_XSPI_WRITE_COMBINE == 0)
+static uint32_t XSPI_VectorSegment(const BSP_XSPI_IoVec_t *pVec, uint32_t *pIndex, uint32_t *pOffset, uint32_t Size,
+                                   const uint8_t **ppData);
+static int32_t XSPI_ProgramPageVector(uint32_t Instance, const BSP_XSPI_IoVec_t *pVec, uint32_t Index,
+                                      uint32_t Offset, uint32_t WriteAddr, uint32_t Size);
+static int32_t XSPI_TransmitVector(uint32_t Instance, const BSP_XSPI_IoVec_t *pVec, uint32_t Index, uint32_t Offset,
+                                   uint32_t Size);
+static int32_t XSPI_WaitFlag(uint32_t Instance, uint32_t Flag, uint32_t Tickstart);
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 0) */
+#endif /* (USE_BSP_XSPI_VECTOR_IO == 1) */
+static int32_t XSPI_EraseBlock(uint32_t Instance, uint32_t BlockAddress, BSP_XSPI_Erase_t BlockSize);
+static int32_t XSPI_EraseChip(uint32_t Instance);
+static int32_t XSPI_EraseRange(uint32_t Instance, uint32_t Address, uint32_t Size);
+static int32_t XSPI_GetStatus(uint32_t Instance);
+static int32_t XSPI_Write(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size);
+static int32_t XSPI_ProgramPage(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size);
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+static int32_t XSPI_WriteCombine(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size);
+static int32_t XSPI_WriteCombineFlush(uint32_t Instance, uint32_t Address, uint32_t Size);
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+#if (USE_BSP_XSPI_SCHEDULER == 1)
+static uint32_t XSPI_SchedulerFind(const XSPI_Scheduler_t *pScheduler, uint32_t ReadOnly);
+static BSP_XSPI_Request_t *XSPI_SchedulerPop(XSPI_Scheduler_t *pScheduler, uint32_t ReadOnly);
+static int32_t XSPI_SchedulerProcess(uint32_t Instance);
+static int32_t XSPI_SchedulerPreempt(uint32_t Instance);
+static void    XSPI_SchedulerBusyDone(uint32_t Instance, int32_t Status);
+static void    XSPI_SchedulerServeReads(uint32_t Instance);
+static void    XSPI_SchedulerStart(uint32_t Instance, BSP_XSPI_Request_t *pRequest);
+static void    XSPI_SchedulerProgramPage(uint32_t Instance);
+static void    XSPI_SchedulerPageDone(uint32_t Instance, int32_t Status);
+#endif /* (USE_BSP_XSPI_SCHEDULER == 1) */
+static void    XSPI_InitCommand(XSPI_RegularCmdTypeDef *pCmd, uint32_t Instruction);
+static void    XSPI_InitProgramCommand(uint32_t Instance, XSPI_RegularCmdTypeDef *pCmd, uint32_t Address,
+                                       uint32_t Size);
+static void    XSPI_InitReadCommand(uint32_t Instance, XSPI_RegularCmdTypeDef *pCmd, uint32_t Address,
+                                    uint32_t Size);
+static int32_t XSPI_ReadData(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size);
+static int32_t XSPI_EnableMemoryMappedMode(uint32_t Instance, BSP_XSPI_MmpOption_t Option);
+static int32_t XSPI_DisableMemoryMappedMode(uint32_t Instance);
+static int32_t XSPI_ExitContinuousRead(uint32_t Instance);
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+static int32_t XSPI_MmpLeave(uint32_t Instance);
+static int32_t XSPI_MmpReenter(uint32_t Instance, int32_t Status);
+static int32_t XSPI_MmpResume(uint32_t Instance);
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+#if (USE_BSP_XSPI_ICACHE == 1)
+static int32_t XSPI_ICacheEnable(uint32_t Instance);
+static int32_t XSPI_ICacheDisable(uint32_t Instance);
+#endif /* (USE_BSP_XSPI_ICACHE == 1) */
+#if (USE_BSP_XSPI_ICACHE == 1) && (USE_BSP_XSPI_BENCHMARK == 1)
+static uint32_t XSPI_MeasureRead(const uint32_t *pArea, uint32_t Size);
+#endif /* (USE_BSP_XSPI_ICACHE == 1) && (USE_BSP_XSPI_BENCHMARK == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+static int32_t XSPI_PowerAccess(uint32_t Instance);
+static int32_t XSPI_PowerProcess(uint32_t Instance);
+static void    XSPI_PowerSetState(uint32_t Instance, uint32_t PowerDown);
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) || (USE_BSP_XSPI_WARM_INIT == 1)
+static void    XSPI_DelayUs(uint32_t Delay);
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) || (USE_BSP_XSPI_WARM_INIT == 1) */
+#if (USE_BSP_XSPI_WARM_INIT == 1)
+static int32_t XSPI_WarmInit(uint32_t Instance);
+#endif /* (USE_BSP_XSPI_WARM_INIT == 1) */
+#if (USE_BSP_XSPI_STATS == 1)
+static void    XSPI_StatsStart(uint32_t Instance);
+static void    XSPI_StatsStop(uint32_t Instance, BSP_XSPI_StatsOp_t Op, uint32_t Size, int32_t Status);
+static void    XSPI_StatsAccount(uint32_t Instance, BSP_XSPI_StatsOp_t Op, uint32_t Size, int32_t Status,
+                                 uint32_t Cycles, uint32_t Polls);
+static void    XSPI_StatsStopPending(uint32_t Instance, BSP_XSPI_StatsOp_t Op, int32_t Status);
+static void    XSPI_StatsEraseStart(uint32_t Instance, uint32_t Size);
+static void    XSPI_StatsEraseEnd(uint32_t Instance, int32_t Status);
+static void    XSPI_StatsEraseSuspend(uint32_t Instance, uint32_t Suspended);
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+static void    XSPI_StatsAsyncStart(uint32_t Instance, uint32_t Size);
+static void    XSPI_StatsAsyncEnd(uint32_t Instance, BSP_XSPI_StatsOp_t Op, int32_t Status);
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+static void    XSPI_TraceStart(uint32_t Instance);
+static void    XSPI_TraceStop(uint32_t Instance, BSP_XSPI_TraceOp_t Op, uint32_t Address, uint32_t Size,
+                              int32_t Status);
+static void    XSPI_TraceDrop(uint32_t Instance);
+static uint32_t XSPI_TraceIsLast(uint32_t Instance, BSP_XSPI_TraceOp_t Op, int32_t Status);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+static void    XSPI_GetTiming(uint32_t Instance, BSP_XSPI_Calibration_t *pTiming);
+static int32_t XSPI_ApplyTiming(uint32_t Instance, const BSP_XSPI_Calibration_t *pTiming);
+#if (USE_BSP_XSPI_BENCHMARK == 1)
+static int32_t XSPI_MeasureProgram(uint32_t Instance, uint32_t Address, uint32_t *pBytesPerSecond);
+static int32_t XSPI_BenchCheckPrescalers(uint32_t Instance, const BSP_XSPI_ProgramBench_t *pResults,
+                                         uint32_t NbResults);
+static uint32_t XSPI_BenchBin(uint32_t Cycles);
+static uint32_t XSPI_BenchBinEdge(uint32_t Bin);
+#endif /* (USE_BSP_XSPI_BENCHMARK == 1) */
+#if (USE_BSP_XSPI_CALIBRATION == 1)
+static uint8_t XSPI_CalibPattern(uint32_t Index);
+static int32_t XSPI_CalibWritePattern(uint32_t Instance, uint32_t Address);
+static uint32_t XSPI_CalibCheckPattern(uint32_t Instance, uint32_t Address);
+static uint32_t XSPI_CalibSweepPhase(uint32_t Instance, uint32_t Address, BSP_XSPI_Calibration_t *pTiming);
+#endif /* (USE_BSP_XSPI_CALIBRATION == 1) */
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+static int32_t XSPI_StartAutoPolling(uint32_t Instance, uint32_t Timeout);
+static int32_t XSPI_AsyncCheck(uint32_t Instance);
+static uint32_t XSPI_GetInstance(const XSPI_HandleTypeDef *pHxspi);
+static void    XSPI_AsyncProcess(uint32_t Instance);
+static void    XSPI_AsyncComplete(uint32_t Instance, int32_t Status);
+static void    XSPI_StatusMatchCallback(XSPI_HandleTypeDef *pHxspi);
+static void    XSPI_CmdCpltCallback(XSPI_HandleTypeDef *pHxspi);
+static void    XSPI_TxCpltCallback(XSPI_HandleTypeDef *pHxspi);
+static void    XSPI_ErrorCallback(XSPI_HandleTypeDef *pHxspi);
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+static int32_t XSPI_CacheRead(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size);
+static void    XSPI_CacheUpdate(uint32_t Instance, const uint8_t *pData, uint32_t Address, uint32_t Size);
+static void    XSPI_CacheInvalidate(uint32_t Instance, uint32_t Address, uint32_t Size);
+static void    XSPI_CacheEraseStart(uint32_t Instance, uint32_t Address, uint32_t Size);
+static uint32_t XSPI_CacheErasing(uint32_t Instance, uint32_t LineAddr);
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+#if (USE_BSP_XSPI_BLANK_CHECK == 1)
+static int32_t XSPI_BlankCheck(uint32_t Instance, uint32_t Address, uint32_t Size, uint32_t *pBlank);
+#endif /* (USE_BSP_XSPI_BLANK_CHECK == 1) */
+#if (USE_BSP_XSPI_WRITE_VERIFY == 1)
+static int32_t XSPI_VerifyPage(uint32_t Instance, const uint8_t *pData, uint32_t Address, uint32_t Size,
+                               uint32_t *pMatch);
+#endif /* (USE_BSP_XSPI_WRITE_VERIFY == 1) */
+#if (USE_BSP_XSPI_READ_CACHE == 1) || (USE_BSP_XSPI_BLANK_CHECK == 1) || (USE_BSP_XSPI_STATS == 1) || \
+    (USE_BSP_XSPI_TRACE == 1)
+static uint32_t XSPI_GetEraseSize(BSP_XSPI_Erase_t BlockSize);
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) || (USE_BSP_XSPI_BLANK_CHECK == 1) || (USE_BSP_XSPI_STATS == 1) ||
+          (USE_BSP_XSPI_TRACE == 1) */
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+static int32_t XSPI_AsyncReadChunk(uint32_t Instance, uint32_t Timeout);
+static void    XSPI_RxCpltCallback(XSPI_HandleTypeDef *pHxspi);
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
 
 /**
   * @}
@@ -130,19 +665,51 @@ static int32_t XSPI_ConfigFlash(uint32_t Instance, BSP_XSPI_Interface_t Mode);
   */
 
 /**
-  * @brief  Initializes the XSPI interface.
+  * @brief  Initializes the XSPI interface, with the read and program commands of the
+  *         interface mode.
   * @param  Instance   XSPI Instance
   * @param  Init       XSPI Init structure
   * @retval BSP status
   */
 int32_t BSP_XSPI_Init(uint32_t Instance, BSP_XSPI_Init_t *Init)
+{
+  BSP_XSPI_InitEx_t init_ex;
+
+  init_ex.InterfaceMode  = Init->InterfaceMode;
+  init_ex.ReadCommand    = BSP_XSPI_READ_DEFAULT;
+  init_ex.DummyCycles    = 0U;
+  init_ex.ProgramCommand = BSP_XSPI_PROGRAM_DEFAULT;
+
+  /* Return BSP status */
+  return BSP_XSPI_InitEx(Instance, &init_ex);
+}
+
+/**
+  * @brief  Initializes the XSPI interface, with the given read and program commands.
+  * @param  Instance   XSPI Instance
+  * @param  Init       XSPI InitEx structure
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_InitEx(uint32_t Instance, BSP_XSPI_InitEx_t *Init)
 {
   int32_t ret;
   BSP_XSPI_Info_t pInfo;
   MX_XSPI_InitTypeDef xspi_init;
+  uint8_t reg[2];
+#if (USE_BSP_XSPI_WARM_INIT == 1)
+  uint32_t warm = 0U;
+#endif /* (USE_BSP_XSPI_WARM_INIT == 1) */
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
 
   /* Check if the instance is supported */
   if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }/* Check the read and program commands */
+  else if (XSPI_CheckCommands(Init) != BSP_ERROR_NONE)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
@@ -151,6 +718,11 @@ int32_t BSP_XSPI_Init(uint32_t Instance, BSP_XSPI_Init_t *Init)
     /* Check if the instance is already initialized */
     if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_NONE)
     {
+      /* Read command profile used by the read functions and the memory-mapped mode */
+      Xspi_Ctx[Instance].ReadCommand = Init->ReadCommand;
+      Xspi_Ctx[Instance].DummyCycles = Init->DummyCycles;
+      Xspi_Ctx[Instance].ProgramCommand = Init->ProgramCommand;
+
 #if (USE_HAL_XSPI_REGISTER_CALLBACKS == 0)
       /* Msp XSPI initialization */
       XSPI_MspInit(&hxspi[Instance]);
@@ -160,6 +732,9 @@ int32_t BSP_XSPI_Init(uint32_t Instance, BSP_XSPI_Init_t *Init)
       {
         if (BSP_XSPI_RegisterDefaultMspCallbacks(Instance) != BSP_ERROR_NONE)
         {
+#if (USE_BSP_XSPI_TRACE == 1)
+          XSPI_TraceStop(Instance, BSP_XSPI_TRACE_INIT, 0U, (uint32_t)Init->InterfaceMode, BSP_ERROR_PERIPH_FAILURE);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
           return BSP_ERROR_PERIPH_FAILURE;
         }
       }
@@ -173,31 +748,92 @@ int32_t BSP_XSPI_Init(uint32_t Instance, BSP_XSPI_Init_t *Init)
       xspi_init.MemorySize     = (uint32_t)POSITION_VAL((uint32_t)pInfo.FlashSize);
       xspi_init.SampleShifting = HAL_XSPI_SAMPLE_SHIFT_NONE;
 
+#if (USE_BSP_XSPI_WARM_INIT == 1)
+      /* Warm init: the XSPI timing saved by BSP_XSPI_SaveContext() is restored by XSPI_WarmInit() */
+      if ((Xspi_SavedCtx[Instance].Valid != 0U) && (Xspi_SavedCtx[Instance].InterfaceMode == Init->InterfaceMode))
+      {
+        warm = 1U;
+      }
+      Xspi_SavedCtx[Instance].Valid = 0U;
+#endif /* (USE_BSP_XSPI_WARM_INIT == 1) */
+
       /* STM32 XSPI interface initialization */
       if (MX_XSPI_Init(&hxspi[Instance], &xspi_init) != HAL_OK)
       {
         ret = BSP_ERROR_PERIPH_FAILURE;
       }
+#if (USE_HAL_XSPI_REGISTER_CALLBACKS == 1) && (USE_BSP_XSPI_IT_FEATURE == 1)
+      /* Register the XSPI status match, transfer complete and error callbacks */
+      else if (HAL_XSPI_RegisterCallback(&hxspi[Instance], HAL_XSPI_STATUS_MATCH_CB_ID,
+                                         XSPI_StatusMatchCallback) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else if (HAL_XSPI_RegisterCallback(&hxspi[Instance], HAL_XSPI_CMD_CPLT_CB_ID, XSPI_CmdCpltCallback) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else if (HAL_XSPI_RegisterCallback(&hxspi[Instance], HAL_XSPI_TX_CPLT_CB_ID, XSPI_TxCpltCallback) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+      else if (HAL_XSPI_RegisterCallback(&hxspi[Instance], HAL_XSPI_RX_CPLT_CB_ID, XSPI_RxCpltCallback) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+      else if (HAL_XSPI_RegisterCallback(&hxspi[Instance], HAL_XSPI_ERROR_CB_ID, XSPI_ErrorCallback) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS == 1) && (USE_BSP_XSPI_IT_FEATURE == 1) */
       else
       {
         /* XSPI Delay Block enable */
         XSPI_DLYB_Enable(Instance);
 
+#if (USE_BSP_XSPI_WARM_INIT == 1)
+        /* Memory still in the saved state: no reset and configuration */
+        if ((warm != 0U) && (XSPI_WarmInit(Instance) == BSP_ERROR_NONE))
+        {
+          ret = BSP_ERROR_NONE;
+        }/* XSPI memory reset */
+        else if (XSPI_ResetMemory(Instance) != BSP_ERROR_NONE)
+#else
         /* XSPI memory reset */
         if (XSPI_ResetMemory(Instance) != BSP_ERROR_NONE)
+#endif /* (USE_BSP_XSPI_WARM_INIT == 1) */
         {
           ret = BSP_ERROR_COMPONENT_FAILURE;
         }/* Check if memory is ready */
-        else if (XSPI_AutoPollingMemReady(&hxspi[Instance]) != BSP_ERROR_NONE)
+        else if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
         {
           ret = BSP_ERROR_COMPONENT_FAILURE;
         }/* Configure the memory */
         else if (XSPI_ConfigFlash(Instance, Init->InterfaceMode) != BSP_ERROR_NONE)
+        {
+          ret = BSP_ERROR_COMPONENT_FAILURE;
+        }/* Get the power mode, kept by the memory across resets */
+        else if (XSPI_ReadConfigRegister(Instance, reg) != BSP_ERROR_NONE)
         {
           ret = BSP_ERROR_COMPONENT_FAILURE;
         }
         else
         {
+          Xspi_Ctx[Instance].PerformanceMode = ((reg[1] & XSPI_NOR_CR2_LH_SWITCH) != 0U) ?
+                                               BSP_XSPI_HIGH_PERFORMANCE_MODE : BSP_XSPI_ULTRA_LOW_POWER_MODE;
+          Xspi_ProgramSuspended[Instance] = 0U;
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+          /* The memory reset left the deep power-down */
+          Xspi_Power[Instance].PowerDown  = 0U;
+          Xspi_Power[Instance].StateTick  = HAL_GetTick();
+          Xspi_Power[Instance].LastAccess = Xspi_Power[Instance].StateTick;
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+          /* Start with an empty read cache */
+          XSPI_CacheInvalidate(Instance, 0U, MX25R3235F_FLASH_SIZE);
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
           ret = BSP_ERROR_NONE;
         }
       }
@@ -208,6 +844,10 @@ int32_t BSP_XSPI_Init(uint32_t Instance, BSP_XSPI_Init_t *Init)
     }
   }
 
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_INIT, 0U, (uint32_t)Init->InterfaceMode, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
   /* Return BSP status */
   return ret;
 }
@@ -221,28 +861,61 @@ int32_t BSP_XSPI_DeInit(uint32_t Instance)
 {
   int32_t ret = BSP_ERROR_NONE;
 
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
   /* Check if the instance is supported */
   if (Instance >= XSPI_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
   else
   {
     /* Check if the instance is already initialized */
     if (Xspi_Ctx[Instance].IsInitialized != XSPI_ACCESS_NONE)
     {
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+      /* Wake up the memory for the last operations */
+      if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+
       /* Disable Memory mapped mode */
       if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
       {
         if (BSP_XSPI_DisableMemoryMappedMode(Instance) != BSP_ERROR_NONE)
         {
+#if (USE_BSP_XSPI_TRACE == 1)
+          XSPI_TraceStop(Instance, BSP_XSPI_TRACE_DEINIT, 0U, 0U, BSP_ERROR_COMPONENT_FAILURE);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
           return BSP_ERROR_COMPONENT_FAILURE;
         }
       }
 
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+      /* Program the pending data before losing the context */
+      if (XSPI_WriteCombineFlush(Instance, 0U, MX25R3235F_FLASH_SIZE) != BSP_ERROR_NONE)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+
       /* Set default Xspi_Ctx values */
       Xspi_Ctx[Instance].IsInitialized = XSPI_ACCESS_NONE;
       Xspi_Ctx[Instance].InterfaceMode = BSP_XSPI_SPI_MODE;
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+      XSPI_CacheInvalidate(Instance, 0U, MX25R3235F_FLASH_SIZE);
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
 
 #if (USE_HAL_XSPI_REGISTER_CALLBACKS == 0)
       XSPI_MspDeInit(&hxspi[Instance]);
@@ -256,9 +929,69 @@ int32_t BSP_XSPI_DeInit(uint32_t Instance)
     }
   }
 
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_DEINIT, 0U, 0U, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+#if (USE_BSP_XSPI_WARM_INIT == 1)
+/**
+  * @brief  Saves the XSPI timing settings and the memory mode before a low-power mode.
+  *         The next BSP_XSPI_Init() with the same interface mode restores them, and only
+  *         checks the memory state instead of resetting and configuring it. The context is
+  *         used once: it has to be saved again before each low-power mode. The memory-mapped
+  *         mode is not part of the context.
+  * @note   The sequence is:
+  *         (+) BSP_XSPI_SaveContext()
+  *         (+) BSP_XSPI_DeInit(), since BSP_XSPI_Init() does nothing on an initialized instance
+  *         (+) low-power mode retaining the SRAM, the memory powered
+  *         (+) BSP_XSPI_Init() with the same interface mode
+  *         The warm init wakes the memory up and takes it out of the continuous read first.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_SaveContext(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_NONE)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* The context is the one of the awake memory */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+  else
+  {
+    XSPI_GetTiming(Instance, &Xspi_SavedCtx[Instance].Timing);
+    Xspi_SavedCtx[Instance].InterfaceMode   = Xspi_Ctx[Instance].InterfaceMode;
+    Xspi_SavedCtx[Instance].PerformanceMode = Xspi_Ctx[Instance].PerformanceMode;
+    Xspi_SavedCtx[Instance].Valid           = 1U;
+  }
+
   /* Return BSP status */
   return ret;
 }
+#endif /* (USE_BSP_XSPI_WARM_INIT == 1) */
 
 /**
   * @brief  Initializes the XSPI interface.
@@ -372,23 +1105,49 @@ int32_t BSP_XSPI_Read(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint
 {
   int32_t ret;
 
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStart(Instance);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
   /* Check if the instance is supported */
   if (Instance >= XSPI_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
   else
   {
-    if (MX25R3235F_Read(&hxspi[Instance], Xspi_Ctx[Instance].InterfaceMode, pData, ReadAddr, Size) != MX25R3235F_OK)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }
-    else
-    {
-      ret = BSP_ERROR_NONE;
-    }
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+    /* Back to the window if the erase or program for which it was left is over,
+       else the data is read in indirect mode */
+    (void)XSPI_MmpResume(Instance);
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+    ret = XSPI_ReadMemory(Instance, pData, ReadAddr, Size);
   }
 
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStop(Instance, BSP_XSPI_STATS_READ, Size, ret);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_READ, ReadAddr, Size, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
   /* Return BSP status */
   return ret;
 }
@@ -403,788 +1162,7200 @@ int32_t BSP_XSPI_Read(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint
   */
 int32_t BSP_XSPI_Write(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
 {
-  int32_t ret = BSP_ERROR_NONE;
-  uint32_t end_addr;
-  uint32_t current_size;
-  uint32_t current_addr;
-  uint32_t data_addr;
+  int32_t ret;
+
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStart(Instance);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
 
   /* Check if the instance is supported */
   if (Instance >= XSPI_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
-  else
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
   {
-    /* Calculation of the size between the write address and the end of the page */
-    current_size = MX25R3235F_PAGE_SIZE - (WriteAddr % MX25R3235F_PAGE_SIZE);
-
-    /* Check if the size of the data is less than the remaining place in the page */
-    if (current_size > Size)
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+  /* Leave the memory-mapped mode for the time of the write */
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
+  {
+    ret = XSPI_MmpLeave(Instance);
+    if (ret == BSP_ERROR_NONE)
     {
-      current_size = Size;
+      ret = XSPI_WriteData(Instance, pData, WriteAddr, Size);
+      ret = XSPI_MmpReenter(Instance, ret);
     }
-
-    /* Initialize the address variables */
-    current_addr = WriteAddr;
-    end_addr = WriteAddr + Size;
-    data_addr = (uint32_t)pData;
-
-    /* Perform the write page by page */
-    do
-    {
-      /* Check if Flash busy ? */
-      if (XSPI_AutoPollingMemReady(&hxspi[Instance]) != BSP_ERROR_NONE)
-      {
-        ret = BSP_ERROR_COMPONENT_FAILURE;
-      }/* Enable write operations */
-      else if (MX25R3235F_WriteEnable(&hxspi[Instance]) != MX25R3235F_OK)
-      {
-        ret = BSP_ERROR_COMPONENT_FAILURE;
-      }
-      else
-      {
-        /* Issue page program command */
-        if (MX25R3235F_PageProgram(&hxspi[Instance], Xspi_Ctx[Instance].InterfaceMode, (uint8_t *)data_addr, current_addr,
-                                    current_size) != MX25R3235F_OK)
-        {
-          ret = BSP_ERROR_COMPONENT_FAILURE;
-        }
-
-        if (ret == BSP_ERROR_NONE)
-        {
-          /* Configure automatic polling mode to wait for end of program */
-          if (XSPI_AutoPollingMemReady(&hxspi[Instance]) != BSP_ERROR_NONE)
-          {
-            ret = BSP_ERROR_COMPONENT_FAILURE;
-          }
-          else
-          {
-            /* Update the address and size variables for next page programming */
-            current_addr += current_size;
-            data_addr += current_size;
-            current_size = ((current_addr + MX25R3235F_PAGE_SIZE) > end_addr)
-                           ? (end_addr - current_addr)
-                           : MX25R3235F_PAGE_SIZE;
-          }
-        }
-      }
-    } while ((current_addr < end_addr) && (ret == BSP_ERROR_NONE));
   }
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+  else
+  {
+    ret = XSPI_WriteData(Instance, pData, WriteAddr, Size);
+  }
+
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStop(Instance, BSP_XSPI_STATS_WRITE, Size, ret);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_WRITE, WriteAddr, Size, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
 
   /* Return BSP status */
   return ret;
 }
 
+#if (USE_BSP_XSPI_VECTOR_IO == 1)
 /**
-  * @brief  Erases the specified block of the XSPI memory.
-  * @param  Instance     XSPI instance
-  * @param  BlockAddress Block address to erase
-  * @param  BlockSize    Erase Block size: MX25R3235F_ERASE_4K, MX25R3235F_ERASE_32K or MX25R3235F_ERASE_64K
+  * @brief  Reads an amount of data from the XSPI memory into a list of buffers.
+  *         The buffers are filled in order from consecutive memory addresses, each
+  *         one directly by the read path of BSP_XSPI_Read(). The call is measured and
+  *         traced as one read of the total size.
+  * @param  Instance  XSPI instance
+  * @param  pVec      Pointer to the buffer descriptors
+  * @param  NbVec     Number of buffer descriptors
+  * @param  ReadAddr  Read start address
   * @retval BSP status
   */
-int32_t BSP_XSPI_Erase_Block(uint32_t Instance, uint32_t BlockAddress, BSP_XSPI_Erase_t BlockSize)
+int32_t BSP_XSPI_ReadV(uint32_t Instance, const BSP_XSPI_IoVec_t *pVec, uint32_t NbVec, uint32_t ReadAddr)
 {
   int32_t ret;
+  uint32_t size = 0U;
+
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStart(Instance);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
 
   /* Check if the instance is supported */
-  if (Instance >= XSPI_INSTANCES_NUMBER)
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pVec == NULL) || (NbVec == 0U))
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
   else
   {
-    /* Check Flash busy ? */
-    if (XSPI_AutoPollingMemReady(&hxspi[Instance]) != BSP_ERROR_NONE)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }/* Enable write operations */
-    else if (MX25R3235F_WriteEnable(&hxspi[Instance]) != MX25R3235F_OK)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }/* Issue Block Erase command */
-    else if (MX25R3235F_BlockErase(&hxspi[Instance],BlockAddress, BlockSize) != MX25R3235F_OK)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }
-    else
-    {
-      ret = BSP_ERROR_NONE;
-    }
+    size = XSPI_VectorSize(pVec, NbVec);
+    ret  = XSPI_ReadVector(Instance, pVec, NbVec, ReadAddr);
   }
 
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStop(Instance, BSP_XSPI_STATS_READ, size, ret);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_READV, ReadAddr, size, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  UNUSED(size);
+
   /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief  Erases the entire XSPI memory.
+  * @brief  Writes the data of a list of buffers to the XSPI memory.
+  *         The buffers are written in order at consecutive memory addresses, without copy.
+  *         A page shared by several buffers is programmed once: one page program command
+  *         sends the parts of all of them, or the write combining image gathers them.
+  *         The call is measured and traced as one write of the total size.
   * @param  Instance  XSPI instance
+  * @param  pVec      Pointer to the buffer descriptors
+  * @param  NbVec     Number of buffer descriptors
+  * @param  WriteAddr Write start address
   * @retval BSP status
   */
-int32_t BSP_XSPI_Erase_Chip(uint32_t Instance)
+int32_t BSP_XSPI_WriteV(uint32_t Instance, const BSP_XSPI_IoVec_t *pVec, uint32_t NbVec, uint32_t WriteAddr)
 {
   int32_t ret;
+  uint32_t size = 0U;
+
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStart(Instance);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
 
   /* Check if the instance is supported */
-  if (Instance >= XSPI_INSTANCES_NUMBER)
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pVec == NULL) || (NbVec == 0U))
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
-  else
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
   {
-    /* Check Flash busy ? */
-    if (XSPI_AutoPollingMemReady(&hxspi[Instance]) != BSP_ERROR_NONE)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }/* Enable write operations */
-    else if (MX25R3235F_WriteEnable(&hxspi[Instance]) != MX25R3235F_OK)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }/* Issue Chip erase command */
-    else if (MX25R3235F_ChipErase(&hxspi[Instance]) != MX25R3235F_OK)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }
-    else
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+  /* Leave the memory-mapped mode once for all the buffers */
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
+  {
+    size = XSPI_VectorSize(pVec, NbVec);
+    ret  = XSPI_MmpLeave(Instance);
+    if (ret == BSP_ERROR_NONE)
     {
-      ret = BSP_ERROR_NONE;
+      ret = XSPI_WriteVector(Instance, pVec, NbVec, WriteAddr);
+      ret = XSPI_MmpReenter(Instance, ret);
     }
   }
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+  else
+  {
+    size = XSPI_VectorSize(pVec, NbVec);
+    ret  = XSPI_WriteVector(Instance, pVec, NbVec, WriteAddr);
+  }
+
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStop(Instance, BSP_XSPI_STATS_WRITE, size, ret);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_WRITEV, WriteAddr, size, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  UNUSED(size);
 
   /* Return BSP status */
   return ret;
 }
+#endif /* (USE_BSP_XSPI_VECTOR_IO == 1) */
 
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
 /**
-  * @brief  Reads current status of the XSPI memory.
+  * @brief  Programs the data pending in the write combining page image.
   * @param  Instance  XSPI instance
-  * @retval XSPI memory status: whether busy or not
+  * @retval BSP status
   */
-int32_t BSP_XSPI_GetStatus(uint32_t Instance)
+int32_t BSP_XSPI_Flush(uint32_t Instance)
 {
-  static uint8_t reg[1];
   int32_t ret;
+  uint32_t size = 0U;
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
 
   /* Check if the instance is supported */
   if (Instance >= XSPI_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
   else
   {
-    if (MX25R3235F_ReadSecurityRegister(&hxspi[Instance], reg) != MX25R3235F_OK)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }/* Check the value of the register */
-    else if ((reg[0] & (MX25R3235F_SECR_P_FAIL | MX25R3235F_SECR_E_FAIL)) != 0U)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }
-    else if ((reg[0] & (MX25R3235F_SECR_PSB | MX25R3235F_SECR_ESB)) != 0U)
-    {
-      ret = BSP_ERROR_XSPI_SUSPENDED;
-    }
-    else if (MX25R3235F_ReadStatusRegister(&hxspi[Instance], reg) != MX25R3235F_OK)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }/* Check the value of the register */
-    else if ((reg[0] & MX25R3235F_SR_WIP) != 0U)
-    {
-      ret = BSP_ERROR_BUSY;
-    }
-    else
-    {
-      ret = BSP_ERROR_NONE;
-    }
+    size = (Xspi_WriteCombine[Instance].Pending != 0U) ?
+           (Xspi_WriteCombine[Instance].End - Xspi_WriteCombine[Instance].Start) : 0U;
+    ret  = XSPI_WriteCombineFlush(Instance, 0U, MX25R3235F_FLASH_SIZE);
   }
 
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_FLUSH, 0U, size, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  UNUSED(size);
+
   /* Return BSP status */
   return ret;
 }
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
 
+#if (USE_BSP_XSPI_SCHEDULER == 1)
 /**
-  * @brief  Return the configuration of the XSPI memory.
+  * @brief  Queues a read, program or erase request. The request is executed by
+  *         BSP_XSPI_Process() and its end is notified by BSP_XSPI_RequestCpltCallback().
+  * @note   The request structure and its data buffer must remain valid until the callback.
+  *         This function can be called from an interrupt handler.
   * @param  Instance  XSPI instance
-  * @param  pInfo     pointer on the configuration structure
+  * @param  pRequest  Pointer to the request
   * @retval BSP status
   */
-int32_t BSP_XSPI_GetInfo(uint32_t Instance, BSP_XSPI_Info_t *pInfo)
+int32_t BSP_XSPI_Submit(uint32_t Instance, BSP_XSPI_Request_t *pRequest)
 {
   int32_t ret = BSP_ERROR_NONE;
+  uint32_t primask;
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
 
   /* Check if the instance is supported */
-  if (Instance >= XSPI_INSTANCES_NUMBER)
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pRequest == NULL))
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
   else
   {
-    (void)MX25R3235F_GetFlashInfo(pInfo);
+    /* Requests can be submitted from interrupt handlers: update the queue with interrupts masked */
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (Xspi_Scheduler[Instance].Count >= BSP_XSPI_QUEUE_DEPTH)
+    {
+      ret = BSP_ERROR_BUSY;
+    }
+    else
+    {
+      Xspi_Scheduler[Instance].Queue[Xspi_Scheduler[Instance].Count] = pRequest;
+      Xspi_Scheduler[Instance].Count++;
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+      /* The memory is woken up by BSP_XSPI_Process(), the idle time restarts from now */
+      Xspi_Power[Instance].LastAccess = HAL_GetTick();
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+    }
+
+    __set_PRIMASK(primask);
   }
 
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_SUBMIT, (pRequest != NULL) ? pRequest->Address : 0U,
+                 (pRequest != NULL) ? pRequest->Size : 0U, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
   /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief  Configure the XSPI in memory-mapped mode
+  * @brief  BSP XSPI scheduler request complete callback.
+  * @param  Instance  XSPI instance
+  * @param  pRequest  Pointer to the completed request
+  * @param  Status    BSP status of the request
+  * @retval None
+  */
+__weak void BSP_XSPI_RequestCpltCallback(uint32_t Instance, BSP_XSPI_Request_t *pRequest, int32_t Status)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+  UNUSED(pRequest);
+  UNUSED(Status);
+
+  /* This function should be implemented by the user application.
+     It is called into this driver when a queued request is completed. */
+}
+#endif /* (USE_BSP_XSPI_SCHEDULER == 1) */
+
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1) || (USE_BSP_XSPI_SCHEDULER == 1) || (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+/**
+  * @brief  Runs the XSPI background tasks. This function should be called periodically
+  *         by the application: it programs the write combining page image once it is
+  *         older than BSP_XSPI_WRITE_COMBINE_TIMEOUT and runs one step of the scheduler,
+  *         after waking the memory up if it is in deep power-down, enters again the
+  *         memory-mapped mode left for an erase or a program once it is over, then puts
+  *         the memory in deep power-down once it is idle. A call is traced only when it
+  *         did one of these tasks or failed.
   * @param  Instance  XSPI instance
   * @retval BSP status
   */
-int32_t BSP_XSPI_EnableMemoryMappedMode(uint32_t Instance)
+int32_t BSP_XSPI_Process(uint32_t Instance)
 {
   int32_t ret = BSP_ERROR_NONE;
+  uint32_t work = 0U;
+#if (USE_BSP_XSPI_SCHEDULER == 1)
+  uint32_t count;
+  const BSP_XSPI_Request_t *busy;
+#endif /* (USE_BSP_XSPI_SCHEDULER == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  uint32_t power_down;
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
 
   /* Check if the instance is supported */
   if (Instance >= XSPI_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
   else
   {
-    if (MX25R3235F_EnableMemoryMappedMode(&hxspi[Instance], Xspi_Ctx[Instance].InterfaceMode) != MX25R3235F_OK)
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+    if ((Xspi_WriteCombine[Instance].Pending != 0U) &&
+        ((HAL_GetTick() - Xspi_WriteCombine[Instance].Tick) >= BSP_XSPI_WRITE_COMBINE_TIMEOUT))
+    {
+      work = 1U;
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+      /* Wake up the memory if it is in deep power-down */
+      if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+      else
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+      {
+        ret = XSPI_WriteCombineFlush(Instance, 0U, MX25R3235F_FLASH_SIZE);
+      }
+    }
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+
+#if (USE_BSP_XSPI_SCHEDULER == 1)
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+    /* Wake up the memory if it is in deep power-down and the scheduler has work to do */
+    if ((ret == BSP_ERROR_NONE) &&
+        ((Xspi_Scheduler[Instance].Count != 0U) || (Xspi_Scheduler[Instance].pBusy != NULL)) &&
+        (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE))
     {
       ret = BSP_ERROR_COMPONENT_FAILURE;
     }
-    else /* Update XSPI context if all operations are well done */
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+
+    if (ret == BSP_ERROR_NONE)
     {
-      Xspi_Ctx[Instance].IsInitialized = XSPI_ACCESS_MMP;
+      /* A step starts or ends a request: a status poll of the on-going one is no work */
+      count = Xspi_Scheduler[Instance].Count;
+      busy  = Xspi_Scheduler[Instance].pBusy;
+      ret   = XSPI_SchedulerProcess(Instance);
+      if ((count != Xspi_Scheduler[Instance].Count) || (busy != Xspi_Scheduler[Instance].pBusy))
+      {
+        work = 1U;
+      }
+    }
+#endif /* (USE_BSP_XSPI_SCHEDULER == 1) */
+
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+    /* Enter again the memory-mapped mode left for an erase or a program once it is over */
+    if ((ret == BSP_ERROR_NONE) && (Xspi_MmpLeft[Instance] != 0U))
+    {
+      ret = XSPI_MmpResume(Instance);
+      if (ret == BSP_ERROR_BUSY)
+      {
+        ret = BSP_ERROR_NONE;
+      }
+      else
+      {
+        work = 1U;
+      }
+    }
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+    if (ret == BSP_ERROR_NONE)
+    {
+      power_down = Xspi_Power[Instance].PowerDown;
+      ret        = XSPI_PowerProcess(Instance);
+      if (power_down != Xspi_Power[Instance].PowerDown)
+      {
+        work = 1U;
+      }
     }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  /* Idle calls are not recorded: periodic calls would overwrite the useful records */
+  if ((work != 0U) || (ret != BSP_ERROR_NONE))
+  {
+    XSPI_TraceStop(Instance, BSP_XSPI_TRACE_PROCESS, 0U, 0U, ret);
+  }
+  else
+  {
+    XSPI_TraceDrop(Instance);
   }
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  UNUSED(work);
 
   /* Return BSP status */
   return ret;
 }
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) || (USE_BSP_XSPI_SCHEDULER == 1) || (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
 
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
 /**
-  * @brief  Exit form memory-mapped mode
-  *         Only 1 Instance can running MMP mode. And it will lock system at this mode.
+  * @brief  Starts writing an amount of data to the XSPI memory without blocking.
+  *         The pages are programmed one after the other under interrupt and
+  *         BSP_XSPI_WriteCpltCallback() is called at the end of the operation.
+  * @note   The data buffer must remain valid until the completion callback. The other
+  *         functions of the instance return BSP_ERROR_BUSY until then. A write still running
+  *         XSPI_ASYNC_PAGE_TIMEOUT ms per page after its start is aborted by the next call of
+  *         one of them, BSP_XSPI_GetStatus() for instance, and completed with an error.
   * @param  Instance  XSPI instance
+  * @param  pData     Pointer to data to be written
+  * @param  WriteAddr Write start address
+  * @param  Size      Size of data to write
   * @retval BSP status
   */
-int32_t BSP_XSPI_DisableMemoryMappedMode(uint32_t Instance)
+int32_t BSP_XSPI_WriteAsync(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
 {
-  int32_t ret = BSP_ERROR_NONE;
+  int32_t ret;
+  uint32_t page_size;
+
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStart(Instance);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
 
   /* Check if the instance is supported */
-  if (Instance >= XSPI_INSTANCES_NUMBER)
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (Size == 0U))
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_NONE)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
+  {
+    ret = BSP_ERROR_XSPI_MMP_LOCK_FAILURE;
+  }
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+  /* No other program is allowed while a program is suspended */
+  else if (Xspi_ProgramSuspended[Instance] != 0U)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+  /* Program the pending page first if it is overwritten */
+  else if (XSPI_WriteCombineFlush(Instance, WriteAddr, Size) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
   else
   {
-    if (Xspi_Ctx[Instance].IsInitialized != XSPI_ACCESS_MMP)
-    {
-      ret = BSP_ERROR_XSPI_MMP_UNLOCK_FAILURE;
-    }/* Abort MMP back to indirect mode */
-    else if (HAL_XSPI_Abort(&hxspi[Instance]) != HAL_OK)
-    {
-      ret = BSP_ERROR_PERIPH_FAILURE;
-    }
-    else /* Update XSPI NOR context if all operations are well done */
+    /* Calculation of the size between the write address and the end of the page */
+    page_size = MX25R3235F_PAGE_SIZE - (WriteAddr % MX25R3235F_PAGE_SIZE);
+
+    Xspi_Async[Instance].pData      = pData;
+    Xspi_Async[Instance].Address    = WriteAddr;
+    Xspi_Async[Instance].EndAddress = WriteAddr + Size;
+    Xspi_Async[Instance].Size       = (page_size > Size) ? Size : page_size;
+    Xspi_Async[Instance].StartTick  = HAL_GetTick();
+    Xspi_Async[Instance].Timeout    = (((WriteAddr + Size - 1U) / MX25R3235F_PAGE_SIZE) -
+                                       (WriteAddr / MX25R3235F_PAGE_SIZE) + 1U) * XSPI_ASYNC_PAGE_TIMEOUT;
+#if (USE_BSP_XSPI_STATS == 1)
+    XSPI_StatsAsyncStart(Instance, Size);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+
+    /* The first step waits for the memory to be ready, the next ones are chained under interrupt */
+    Xspi_Async[Instance].State = XSPI_ASYNC_WAIT_READY;
+
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+    /* The written area is programmed under interrupt: drop its cached lines */
+    XSPI_CacheInvalidate(Instance, WriteAddr, Size);
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+    /* Tune the FIFO threshold to the DMA burst length */
+    (void)HAL_XSPI_SetFifoThreshold(&hxspi[Instance], BSP_XSPI_DMA_FIFO_THRESHOLD);
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+
+    ret = XSPI_StartAutoPolling(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE);
+    if (ret != BSP_ERROR_NONE)
     {
-      Xspi_Ctx[Instance].IsInitialized = XSPI_ACCESS_INDIRECT;
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+      (void)HAL_XSPI_SetFifoThreshold(&hxspi[Instance], hxspi[Instance].Init.FifoThresholdByte);
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+      Xspi_Async[Instance].State = XSPI_ASYNC_IDLE;
     }
   }
 
+#if (USE_BSP_XSPI_STATS == 1)
+  /* A started write is measured up to its completion */
+  XSPI_StatsStopPending(Instance, BSP_XSPI_STATS_WRITE, ret);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_WRITE_ASYNC, WriteAddr, Size, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
   /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief  Get flash ID 3 Bytes:
-  *         Manufacturer ID, Memory type, Memory density
+  * @brief  BSP XSPI asynchronous write complete callback.
   * @param  Instance  XSPI instance
-  * @param  Id Pointer to retrieve ID from memory
+  * @param  Status    BSP status of the write operation
+  * @retval None
+  */
+__weak void BSP_XSPI_WriteCpltCallback(uint32_t Instance, int32_t Status)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+  UNUSED(Status);
+
+  /* This function should be implemented by the user application.
+     It is called into this driver when an asynchronous write is completed. */
+}
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+/**
+  * @brief  Reads an amount of data from the XSPI memory using DMA.
+  *         Reads longer than BSP_XSPI_DMA_MAX_TRANSFER are split in several DMA
+  *         transfers and BSP_XSPI_ReadCpltCallback() is called once all are done.
+  * @note   The data buffer must remain valid until the completion callback.
+  * @param  Instance  XSPI instance
+  * @param  pData     Pointer to data to be read
+  * @param  ReadAddr  Read start address
+  * @param  Size      Size of data to read
   * @retval BSP status
   */
-int32_t BSP_XSPI_ReadID(uint32_t Instance, uint8_t *Id)
+int32_t BSP_XSPI_ReadDMA(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
 {
   int32_t ret;
 
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStart(Instance);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
   /* Check if the instance is supported */
-  if (Instance >= XSPI_INSTANCES_NUMBER)
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (Size == 0U))
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
-  else if (MX25R3235F_ReadID(&hxspi[Instance], Id) != MX25R3235F_OK)
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
   {
     ret = BSP_ERROR_COMPONENT_FAILURE;
   }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_NONE)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
+  {
+    ret = BSP_ERROR_XSPI_MMP_LOCK_FAILURE;
+  }
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+  /* Program the pending page first if it is read */
+  else if (XSPI_WriteCombineFlush(Instance, ReadAddr, Size) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
   else
   {
-    ret = BSP_ERROR_NONE;
+    Xspi_Async[Instance].pRxData    = pData;
+    Xspi_Async[Instance].Address    = ReadAddr;
+    Xspi_Async[Instance].EndAddress = ReadAddr + Size;
+    Xspi_Async[Instance].Size       = (Size > BSP_XSPI_DMA_MAX_TRANSFER) ? BSP_XSPI_DMA_MAX_TRANSFER : Size;
+    Xspi_Async[Instance].StartTick  = HAL_GetTick();
+    Xspi_Async[Instance].Timeout    = HAL_XSPI_TIMEOUT_DEFAULT_VALUE;
+    Xspi_Async[Instance].State      = XSPI_ASYNC_READ;
+#if (USE_BSP_XSPI_STATS == 1)
+    XSPI_StatsAsyncStart(Instance, Size);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+
+    /* Tune the FIFO threshold to the DMA burst length */
+    (void)HAL_XSPI_SetFifoThreshold(&hxspi[Instance], BSP_XSPI_DMA_FIFO_THRESHOLD);
+
+    ret = XSPI_AsyncReadChunk(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE);
+    if (ret != BSP_ERROR_NONE)
+    {
+      (void)HAL_XSPI_SetFifoThreshold(&hxspi[Instance], hxspi[Instance].Init.FifoThresholdByte);
+      Xspi_Async[Instance].State = XSPI_ASYNC_IDLE;
+    }
   }
 
+#if (USE_BSP_XSPI_STATS == 1)
+  /* A started read is measured up to its completion */
+  XSPI_StatsStopPending(Instance, BSP_XSPI_STATS_READ, ret);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_READ_DMA, ReadAddr, Size, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
   /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief  Set Flash to desired Interface mode. And this instance becomes current instance.
-  *         If current instance running at MMP mode then this function doesn't work.
-  *         Indirect -> Indirect
+  * @brief  BSP XSPI DMA read complete callback.
   * @param  Instance  XSPI instance
-  * @param  Mode      XSPI mode
+  * @param  Status    BSP status of the read operation
+  * @retval None
+  */
+__weak void BSP_XSPI_ReadCpltCallback(uint32_t Instance, int32_t Status)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+  UNUSED(Status);
+
+  /* This function should be implemented by the user application.
+     It is called into this driver when a DMA read is completed. */
+}
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+
+/**
+  * @brief  Erases the specified block of the XSPI memory.
+  * @param  Instance     XSPI instance
+  * @param  BlockAddress Block address to erase
+  * @param  BlockSize    Erase Block size: MX25R3235F_ERASE_4K, MX25R3235F_ERASE_32K or MX25R3235F_ERASE_64K
   * @retval BSP status
   */
-static int32_t XSPI_ConfigFlash(uint32_t Instance, BSP_XSPI_Interface_t Mode)
+int32_t BSP_XSPI_Erase_Block(uint32_t Instance, uint32_t BlockAddress, BSP_XSPI_Erase_t BlockSize)
 {
-  int32_t ret = BSP_ERROR_NONE;
+  int32_t ret;
+
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStart(Instance);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
 
   /* Check if the instance is supported */
   if (Instance >= XSPI_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
-  else
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
   {
-    /* Check if MMP mode locked ************************************************/
-    if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
-    {
-      ret = BSP_ERROR_XSPI_MMP_LOCK_FAILURE;
-    }
-    else
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+  /* Leave the memory-mapped mode for the time of the erase */
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
+  {
+    ret = XSPI_MmpLeave(Instance);
+    if (ret == BSP_ERROR_NONE)
     {
-      /* Setup Flash interface ***************************************************/
-      switch (Xspi_Ctx[Instance].InterfaceMode)
-      {
-        case BSP_XSPI_QPI_MODE :  /* 1-4-4 commands */
-          if (Mode != BSP_XSPI_QPI_MODE)
-          {
-            /* Exit QPI mode */
-            ret = XSPI_ExitQPIMode(Instance);
-          }
-          break;
-
-        case BSP_XSPI_SPI_MODE :  /* 1-1-1 commands, Power on H/W default setting */
-        default :
-          if (Mode == BSP_XSPI_QPI_MODE)
-          {
-            /* Enter QPI mode */
-            ret = XSPI_EnterQPIMode(Instance);
-          }
-          break;
-      }
-
-      /* Update XSPI context if all operations are well done */
-      if (ret == BSP_ERROR_NONE)
-      {
-        /* Update current status parameter *****************************************/
-        Xspi_Ctx[Instance].IsInitialized = XSPI_ACCESS_INDIRECT;
-        Xspi_Ctx[Instance].InterfaceMode = Mode;
-      }
+      ret = XSPI_EraseBlock(Instance, BlockAddress, BlockSize);
+      ret = XSPI_MmpReenter(Instance, ret);
     }
   }
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+  else
+  {
+    ret = XSPI_EraseBlock(Instance, BlockAddress, BlockSize);
+  }
+
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStopPending(Instance, BSP_XSPI_STATS_ERASE, ret);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_ERASE_BLOCK, BlockAddress, XSPI_GetEraseSize(BlockSize), ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
 
   /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief  This function suspends an ongoing erase command.
+  * @brief  Erases the entire XSPI memory.
   * @param  Instance  XSPI instance
   * @retval BSP status
   */
-int32_t BSP_XSPI_SuspendErase(uint32_t Instance)
+int32_t BSP_XSPI_Erase_Chip(uint32_t Instance)
 {
   int32_t ret;
 
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStart(Instance);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
   /* Check if the instance is supported */
   if (Instance >= XSPI_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
-  /* Check whether the device is busy (erase operation is in progress). */
-  else if (BSP_XSPI_GetStatus(Instance) != BSP_ERROR_BUSY)
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    ret = BSP_ERROR_BUSY;
   }
-  else if (MX25R3235F_Suspend(&hxspi[Instance]) != MX25R3235F_OK)
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
   {
     ret = BSP_ERROR_COMPONENT_FAILURE;
   }
-  else if (BSP_XSPI_GetStatus(Instance) != BSP_ERROR_XSPI_SUSPENDED)
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+  /* Leave the memory-mapped mode for the time of the erase */
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    ret = XSPI_MmpLeave(Instance);
+    if (ret == BSP_ERROR_NONE)
+    {
+      ret = XSPI_EraseChip(Instance);
+      ret = XSPI_MmpReenter(Instance, ret);
+    }
   }
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
   else
   {
-    ret = BSP_ERROR_NONE;
+    ret = XSPI_EraseChip(Instance);
   }
 
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStopPending(Instance, BSP_XSPI_STATS_ERASE, ret);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_ERASE_CHIP, 0U, MX25R3235F_FLASH_SIZE, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
   /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief  This function resumes a paused erase command.
+  * @brief  Erases an area of the XSPI memory and waits for the end of the operation.
+  *         The area is covered with the largest blocks fitting in it, which gives the
+  *         shortest erase time: 64KB blocks, then 32KB and 4KB blocks on the edges.
   * @param  Instance  XSPI instance
+  * @param  Address   Start address of the area, multiple of BSP_XSPI_BLOCK_4K
+  * @param  Size      Size of the area, multiple of BSP_XSPI_BLOCK_4K
   * @retval BSP status
   */
-int32_t BSP_XSPI_ResumeErase(uint32_t Instance)
+int32_t BSP_XSPI_EraseRange(uint32_t Instance, uint32_t Address, uint32_t Size)
 {
   int32_t ret;
 
-  /* Check if the instance is supported */
-  if (Instance >= XSPI_INSTANCES_NUMBER)
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStart(Instance);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check the parameters: the area must not clip data of a block outside of it */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (Size == 0U) ||
+      ((Address % BSP_XSPI_BLOCK_4K) != 0U) || ((Size % BSP_XSPI_BLOCK_4K) != 0U) ||
+      (Address >= MX25R3235F_FLASH_SIZE) || (Size > (MX25R3235F_FLASH_SIZE - Address)))
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
-  /* Check whether the device is busy (erase operation is in progress). */
-  else if (BSP_XSPI_GetStatus(Instance) != BSP_ERROR_XSPI_SUSPENDED)
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    ret = BSP_ERROR_BUSY;
   }
-  else if (MX25R3235F_Resume(&hxspi[Instance]) != MX25R3235F_OK)
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
   {
     ret = BSP_ERROR_COMPONENT_FAILURE;
   }
-  /*
-  When this command is executed, the status register write in progress bit is set to 1, and
-  the flag status register program erase controller bit is set to 0. This command is ignored
-  if the device is not in a suspended state.
-  */
-  else if (BSP_XSPI_GetStatus(Instance) != BSP_ERROR_BUSY)
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+  /* Leave the memory-mapped mode once for all the blocks */
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    ret = XSPI_MmpLeave(Instance);
+    if (ret == BSP_ERROR_NONE)
+    {
+      ret = XSPI_EraseRange(Instance, Address, Size);
+      ret = XSPI_MmpReenter(Instance, ret);
+    }
   }
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
   else
   {
-    ret = BSP_ERROR_NONE;
+    ret = XSPI_EraseRange(Instance, Address, Size);
   }
 
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsStopPending(Instance, BSP_XSPI_STATS_ERASE, ret);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_ERASE_RANGE, Address, Size, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
   /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief  This function enter the XSPI memory in deep power down mode.
+  * @brief  Reads current status of the XSPI memory.
+  *         With USE_BSP_XSPI_MMP_ARBITRATION, the memory-mapped mode left for an erase or
+  *         a program is entered again once the memory is ready. Repeated polls are
+  *         traced once, when the status changes.
   * @param  Instance  XSPI instance
-  * @retval BSP status
+  * @retval XSPI memory status: whether busy or not
   */
-int32_t BSP_XSPI_EnterDeepPowerDown(uint32_t Instance)
+int32_t BSP_XSPI_GetStatus(uint32_t Instance)
 {
   int32_t ret;
 
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
   /* Check if the instance is supported */
   if (Instance >= XSPI_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
-  else if (MX25R3235F_EnterPowerDown(&hxspi[Instance]) != MX25R3235F_OK)
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
   {
     ret = BSP_ERROR_COMPONENT_FAILURE;
   }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+  /* Leave the memory-mapped mode for the time of the register reads */
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
+  {
+    ret = XSPI_MmpLeave(Instance);
+    if (ret == BSP_ERROR_NONE)
+    {
+      ret = XSPI_GetStatus(Instance);
+      ret = XSPI_MmpReenter(Instance, ret);
+    }
+  }
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
   else
   {
-    ret = BSP_ERROR_NONE;
+    ret = XSPI_GetStatus(Instance);
   }
 
-  /* ---          Memory takes 10us max to enter deep power down          --- */
+#if (USE_BSP_XSPI_TRACE == 1)
+  /* A poll is recorded only when its status differs from the previous record */
+  if (XSPI_TraceIsLast(Instance, BSP_XSPI_TRACE_GET_STATUS, ret) != 0U)
+  {
+    XSPI_TraceDrop(Instance);
+  }
+  else
+  {
+    XSPI_TraceStop(Instance, BSP_XSPI_TRACE_GET_STATUS, 0U, 0U, ret);
+  }
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
 
   /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief  This function leave the XSPI memory from deep power down mode.
+  * @brief  Return the configuration of the XSPI memory.
   * @param  Instance  XSPI instance
+  * @param  pInfo     pointer on the configuration structure
   * @retval BSP status
   */
-int32_t BSP_XSPI_LeaveDeepPowerDown(uint32_t Instance)
+int32_t BSP_XSPI_GetInfo(uint32_t Instance, BSP_XSPI_Info_t *pInfo)
 {
-  int32_t ret;
+  int32_t ret = BSP_ERROR_NONE;
 
   /* Check if the instance is supported */
   if (Instance >= XSPI_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
-  else if (MX25R3235F_NoOperation(&hxspi[Instance]) != MX25R3235F_OK)
-  {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
-  }
   else
   {
-    ret = BSP_ERROR_NONE;
+    (void)MX25R3235F_GetFlashInfo(pInfo);
   }
 
-  /* --- A NOP command is sent to the memory, as the nCS should be low for at least 20 ns --- */
-  /* ---                  Memory takes 30us min to leave deep power down                  --- */
-
   /* Return BSP status */
   return ret;
 }
-/**
-  * @}
-  */
-
-/** @addtogroup STM32WBAXX_NUCLEO_XSPI_Private_Functions
-  * @{
-  */
 
+#if (USE_BSP_XSPI_READ_CACHE == 1)
 /**
-  * @brief  Initializes the XSPI MSP.
-  * @param  hxspi XSPI handle
-  * @retval None
+  * @brief  Invalidate all the lines of the XSPI read cache.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_InvalidateCache(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    XSPI_CacheInvalidate(Instance, 0U, MX25R3235F_FLASH_SIZE);
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Return the hit/miss counters of the XSPI read cache.
+  * @param  Instance  XSPI instance
+  * @param  pStats    pointer on the statistics structure
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_GetCacheStats(uint32_t Instance, BSP_XSPI_CacheStats_t *pStats)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pStats == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    *pStats = Xspi_CacheStats[Instance];
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Reset the hit/miss counters of the XSPI read cache.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_ResetCacheStats(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    Xspi_CacheStats[Instance].Hits      = 0U;
+    Xspi_CacheStats[Instance].Misses    = 0U;
+    Xspi_CacheStats[Instance].Evictions = 0U;
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+
+#if (USE_BSP_XSPI_BLANK_CHECK == 1)
+/**
+  * @brief  Return the numbers of performed and skipped block erases.
+  * @param  Instance  XSPI instance
+  * @param  pStats    pointer on the statistics structure
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_GetEraseStats(uint32_t Instance, BSP_XSPI_EraseStats_t *pStats)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pStats == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    *pStats = Xspi_EraseStats[Instance];
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Reset the counters of performed and skipped block erases.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_ResetEraseStats(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    Xspi_EraseStats[Instance].Performed = 0U;
+    Xspi_EraseStats[Instance].Skipped   = 0U;
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_BLANK_CHECK == 1) */
+
+#if (USE_BSP_XSPI_CALIBRATION == 1)
+/**
+  * @brief  Looks for the fastest reliable timing settings of the XSPI and applies them.
+  *         The prescalers are tried from the fastest one of the performance mode of the memory
+  *         up to the current one.
+  *         For each of them, all the sample shifting and delay hold settings are tried with a
+  *         sweep of the delay block phase, reading back a pattern written in a reserved sector.
+  *         The setting with the largest window of passing phases is kept, with the phase at
+  *         the center of the window, and confirmed by a write and read at this setting.
+  * @note   The sector at Address must be reserved for the calibration: its content is lost.
+  *         The returned settings can be stored and given to BSP_XSPI_ApplyCalibration() at
+  *         the next boot, after BSP_XSPI_Init().
+  * @param  Instance  XSPI instance
+  * @param  Address   Address of the reserved sector, multiple of BSP_XSPI_BLOCK_4K
+  * @param  pCalib    Pointer to the applied timing settings
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_Calibrate(uint32_t Instance, uint32_t Address, BSP_XSPI_Calibration_t *pCalib)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  BSP_XSPI_Calibration_t initial_timing;
+  BSP_XSPI_Calibration_t timing;
+  BSP_XSPI_Calibration_t best_timing = {0};
+  uint32_t best_window;
+  uint32_t window;
+  uint32_t shift;
+  uint32_t found = 0U;
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check the parameters */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pCalib == NULL) || ((Address % BSP_XSPI_BLOCK_4K) != 0U) ||
+      (Address >= MX25R3235F_FLASH_SIZE))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_NONE)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
+  {
+    ret = BSP_ERROR_XSPI_MMP_LOCK_FAILURE;
+  }
+  else
+  {
+    /* The pattern is written with the current settings, which must be reliable */
+    XSPI_GetTiming(Instance, &initial_timing);
+    ret = XSPI_CalibWritePattern(Instance, Address);
+    if ((ret == BSP_ERROR_NONE) && (XSPI_CalibCheckPattern(Instance, Address) == 0U))
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+
+    timing.ClockPrescaler = (Xspi_Ctx[Instance].PerformanceMode == BSP_XSPI_HIGH_PERFORMANCE_MODE) ?
+                            BSP_XSPI_HP_PRESCALER : BSP_XSPI_ULP_PRESCALER;
+    while ((ret == BSP_ERROR_NONE) && (found == 0U) && (timing.ClockPrescaler <= initial_timing.ClockPrescaler))
+    {
+      /* Sample shifting and delay hold settings giving the largest phase window */
+      best_window = 0U;
+      for (shift = 0U; shift < 4U; shift++)
+      {
+        timing.SampleShifting        = ((shift & 1U) == 0U) ? HAL_XSPI_SAMPLE_SHIFT_NONE : HAL_XSPI_SAMPLE_SHIFT_HALFCYCLE;
+        timing.DelayHoldQuarterCycle = ((shift & 2U) == 0U) ? HAL_XSPI_DHQC_DISABLE : HAL_XSPI_DHQC_ENABLE;
+
+        window = XSPI_CalibSweepPhase(Instance, Address, &timing);
+        if (window > best_window)
+        {
+          best_window = window;
+          best_timing = timing;
+        }
+      }
+
+      /* Confirm the setting with a write and a read */
+      if (best_window != 0U)
+      {
+        if ((XSPI_ApplyTiming(Instance, &best_timing) == BSP_ERROR_NONE) &&
+            (XSPI_CalibWritePattern(Instance, Address) == BSP_ERROR_NONE) &&
+            (XSPI_CalibCheckPattern(Instance, Address) != 0U))
+        {
+          found = 1U;
+        }
+        else
+        {
+          /* The pattern written at this setting may be wrong: write it again with the initial settings */
+          ret = XSPI_ApplyTiming(Instance, &initial_timing);
+          if (ret == BSP_ERROR_NONE)
+          {
+            ret = XSPI_CalibWritePattern(Instance, Address);
+          }
+          if ((ret == BSP_ERROR_NONE) && (XSPI_CalibCheckPattern(Instance, Address) == 0U))
+          {
+            ret = BSP_ERROR_COMPONENT_FAILURE;
+          }
+        }
+      }
+
+      if (found == 0U)
+      {
+        timing.ClockPrescaler++;
+      }
+    }
+
+    if (found != 0U)
+    {
+      *pCalib = best_timing;
+    }
+    else
+    {
+      /* Back to the initial settings */
+      (void)XSPI_ApplyTiming(Instance, &initial_timing);
+      if (ret == BSP_ERROR_NONE)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+    }
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_CALIBRATE, Address, BSP_XSPI_BLOCK_4K, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Applies timing settings returned by BSP_XSPI_Calibrate().
+  * @param  Instance  XSPI instance
+  * @param  pCalib    Pointer to the timing settings
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_ApplyCalibration(uint32_t Instance, const BSP_XSPI_Calibration_t *pCalib)
+{
+  int32_t ret;
+
+  /* Check the parameters */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pCalib == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }/* Check the stored settings: no clock above the one of the performance mode of the memory */
+  else if ((pCalib->ClockPrescaler > XSPI_PRESCALER_MAX) ||
+           (pCalib->ClockPrescaler < ((Xspi_Ctx[Instance].PerformanceMode == BSP_XSPI_HIGH_PERFORMANCE_MODE) ?
+                                      BSP_XSPI_HP_PRESCALER : BSP_XSPI_ULP_PRESCALER)) ||
+           ((pCalib->SampleShifting != HAL_XSPI_SAMPLE_SHIFT_NONE) &&
+            (pCalib->SampleShifting != HAL_XSPI_SAMPLE_SHIFT_HALFCYCLE)) ||
+           ((pCalib->DelayHoldQuarterCycle != HAL_XSPI_DHQC_DISABLE) &&
+            (pCalib->DelayHoldQuarterCycle != HAL_XSPI_DHQC_ENABLE)) ||
+           (pCalib->DlybPhaseSel >= XSPI_DLYB_PHASE_NBR))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_NONE)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
+  {
+    ret = BSP_ERROR_XSPI_MMP_LOCK_FAILURE;
+  }
+  else
+  {
+    ret = XSPI_ApplyTiming(Instance, pCalib);
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_CALIBRATION == 1) */
+
+#if (USE_BSP_XSPI_BENCHMARK == 1)
+/**
+  * @brief  Measures the program throughput with the single (PP) and quad (4PP) page
+  *         program commands, for each clock prescaler given in the results array.
+  *         Each measure erases the 4KB sector at Address and programs it entirely.
+  * @note   The sector at Address must be reserved for the benchmark: its content is lost.
+  *         The quad program is measured only in QPI mode.
+  * @param  Instance   XSPI instance
+  * @param  Address    Address of the reserved sector, multiple of BSP_XSPI_BLOCK_4K
+  * @param  pResults   Results array, the ClockPrescaler field of each entry must be set, not
+  *                    below the prescaler of the performance mode of the memory
+  *                    (BSP_XSPI_HP_PRESCALER or BSP_XSPI_ULP_PRESCALER)
+  * @param  NbResults  Number of entries of the results array
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_BenchmarkProgram(uint32_t Instance, uint32_t Address, BSP_XSPI_ProgramBench_t *pResults,
+                                  uint32_t NbResults)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  BSP_XSPI_Calibration_t timing;
+  BSP_XSPI_Calibration_t initial_timing;
+  uint32_t index;
+  BSP_XSPI_ProgramCommand_t command;
+
+  /* Check the parameters */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pResults == NULL) || ((Address % BSP_XSPI_BLOCK_4K) != 0U) ||
+      (Address >= MX25R3235F_FLASH_SIZE) ||
+      (XSPI_BenchCheckPrescalers(Instance, pResults, NbResults) != BSP_ERROR_NONE))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_SCHEDULER == 1)
+  /* Check if a scheduled erase or program is on-going */
+  else if (Xspi_Scheduler[Instance].pBusy != NULL)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_SCHEDULER == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_NONE)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
+  {
+    ret = BSP_ERROR_XSPI_MMP_LOCK_FAILURE;
+  }
+  else
+  {
+    XSPI_GetTiming(Instance, &initial_timing);
+    command = Xspi_Ctx[Instance].ProgramCommand;
+
+    /* Enable the cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (index = 0U; (index < NbResults) && (ret == BSP_ERROR_NONE); index++)
+    {
+      pResults[index].SingleProgram = 0U;
+      pResults[index].QuadProgram   = 0U;
+
+      /* Default delay block setting for the clock of the measure */
+      timing = initial_timing;
+      timing.ClockPrescaler = pResults[index].ClockPrescaler;
+      timing.DlybPhaseSel   = 0U;
+      ret = XSPI_ApplyTiming(Instance, &timing);
+      if (ret == BSP_ERROR_NONE)
+      {
+        Xspi_Ctx[Instance].ProgramCommand = BSP_XSPI_PROGRAM_PP;
+        ret = XSPI_MeasureProgram(Instance, Address, &pResults[index].SingleProgram);
+      }
+      if ((ret == BSP_ERROR_NONE) && (Xspi_Ctx[Instance].InterfaceMode == BSP_XSPI_QPI_MODE))
+      {
+        Xspi_Ctx[Instance].ProgramCommand = BSP_XSPI_PROGRAM_4PP;
+        ret = XSPI_MeasureProgram(Instance, Address, &pResults[index].QuadProgram);
+      }
+    }
+
+    /* Restore the configuration of the instance */
+    Xspi_Ctx[Instance].ProgramCommand = command;
+    if (XSPI_ApplyTiming(Instance, &initial_timing) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Runs a workload of NbOps operations on a reserved memory area through the BSP
+  *         read, write and erase functions, so with the enabled cache, write combining
+  *         and erase options, and measures its throughput and latency.
+  *         BSP_XSPI_WORKLOAD_SEQ_READ and BSP_XSPI_WORKLOAD_RANDOM_READ read pages in order
+  *         or at pseudo-random addresses. BSP_XSPI_WORKLOAD_SMALL_WRITE writes small records
+  *         in order, the area being erased again when full. BSP_XSPI_WORKLOAD_MIXED draws
+  *         random page reads and small writes. The area is erased first. With write
+  *         combining, the final flush of the pending data is one more latency sample.
+  * @note   The content of the area is lost. The latency histogram takes about 1KB of stack.
+  * @param  Instance  XSPI instance
+  * @param  Workload  Workload to run
+  * @param  Address   Start address of the area, 4KB aligned
+  * @param  Size      Size of the area, multiple of 4KB
+  * @param  NbOps     Number of operations
+  * @param  pResult   Pointer to the result
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_BenchmarkWorkload(uint32_t Instance, BSP_XSPI_Workload_t Workload, uint32_t Address,
+                                   uint32_t Size, uint32_t NbOps, BSP_XSPI_WorkloadBench_t *pResult)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint8_t buffer[XSPI_BENCH_READ_SIZE];
+  uint32_t histogram[XSPI_BENCH_BINS] = {0};
+  uint32_t op;
+  uint32_t seed = XSPI_BENCH_SEED;
+  uint32_t write_offset = 0U;
+  uint32_t offset;
+  uint32_t start;
+  uint32_t cycles;
+  uint32_t max_cycles = 0U;
+  uint32_t bin;
+  uint32_t count;
+  uint32_t samples = NbOps;
+  uint64_t total_cycles = 0U;
+  uint64_t bytes = 0U;
+
+  /* Check the parameters */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pResult == NULL) || (Workload > BSP_XSPI_WORKLOAD_MIXED) ||
+      (NbOps == 0U) || (Size == 0U) || ((Address % BSP_XSPI_BLOCK_4K) != 0U) ||
+      ((Size % BSP_XSPI_BLOCK_4K) != 0U) || (Address >= MX25R3235F_FLASH_SIZE) ||
+      (Size > (MX25R3235F_FLASH_SIZE - Address)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_NONE)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    /* Enable the cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (offset = 0U; offset < XSPI_BENCH_READ_SIZE; offset++)
+    {
+      buffer[offset] = (uint8_t)offset;
+    }
+
+    ret = BSP_XSPI_EraseRange(Instance, Address, Size);
+
+    for (op = 0U; (op < NbOps) && (ret == BSP_ERROR_NONE); op++)
+    {
+      /* Linear congruential generator of the random addresses and operations */
+      seed = (seed * 1664525U) + 1013904223U;
+
+      start = DWT->CYCCNT;
+      if ((Workload == BSP_XSPI_WORKLOAD_SMALL_WRITE) ||
+          ((Workload == BSP_XSPI_WORKLOAD_MIXED) && ((seed >> 24) < XSPI_BENCH_MIXED_WRITES)))
+      {
+        /* Area full: erase it again, as part of the write which needs it */
+        if ((write_offset + XSPI_BENCH_WRITE_SIZE) > Size)
+        {
+          ret = BSP_XSPI_EraseRange(Instance, Address, Size);
+          write_offset = 0U;
+        }
+        if (ret == BSP_ERROR_NONE)
+        {
+          ret = BSP_XSPI_Write(Instance, buffer, Address + write_offset, XSPI_BENCH_WRITE_SIZE);
+        }
+        write_offset += XSPI_BENCH_WRITE_SIZE;
+        bytes += XSPI_BENCH_WRITE_SIZE;
+      }
+      else
+      {
+        if (Workload == BSP_XSPI_WORKLOAD_SEQ_READ)
+        {
+          offset = (op * XSPI_BENCH_READ_SIZE) % Size;
+        }
+        else
+        {
+          offset = ((seed >> 8) % (Size / XSPI_BENCH_READ_SIZE)) * XSPI_BENCH_READ_SIZE;
+        }
+        ret = BSP_XSPI_Read(Instance, buffer, Address + offset, XSPI_BENCH_READ_SIZE);
+        bytes += XSPI_BENCH_READ_SIZE;
+      }
+      cycles = DWT->CYCCNT - start;
+
+      total_cycles += cycles;
+      if (cycles > max_cycles)
+      {
+        max_cycles = cycles;
+      }
+      histogram[XSPI_BenchBin(cycles)]++;
+    }
+
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+    /* The data still combined is part of the workload: its program is one more sample */
+    if (ret == BSP_ERROR_NONE)
+    {
+      start = DWT->CYCCNT;
+      ret = BSP_XSPI_Flush(Instance);
+      cycles = DWT->CYCCNT - start;
+
+      total_cycles += cycles;
+      if (cycles > max_cycles)
+      {
+        max_cycles = cycles;
+      }
+      histogram[XSPI_BenchBin(cycles)]++;
+      samples++;
+    }
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+
+    if ((ret == BSP_ERROR_NONE) && (total_cycles != 0U))
+    {
+      pResult->Operations     = NbOps;
+      pResult->OpsPerSecond   = (uint32_t)(((uint64_t)NbOps * SystemCoreClock) / total_cycles);
+      pResult->BytesPerSecond = (uint32_t)((bytes * SystemCoreClock) / total_cycles);
+      pResult->MaxLatency     = (uint32_t)(((uint64_t)max_cycles * 1000000U) / SystemCoreClock);
+
+      /* 99th percentile: upper bound of the bin reaching 99% of the samples, at most the maximum */
+      count = 0U;
+      bin = 0U;
+      while ((count + histogram[bin]) < (samples - (samples / 100U)))
+      {
+        count += histogram[bin];
+        bin++;
+      }
+      cycles = XSPI_BenchBinEdge(bin);
+      if (cycles > max_cycles)
+      {
+        cycles = max_cycles;
+      }
+      pResult->P99Latency = (uint32_t)(((uint64_t)cycles * 1000000U) / SystemCoreClock);
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_BENCHMARK == 1) */
+
+/**
+  * @brief  Configure the XSPI in memory-mapped mode
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_EnableMemoryMappedMode(uint32_t Instance)
+{
+  return BSP_XSPI_EnableMemoryMappedModeEx(Instance, BSP_XSPI_MMP_DEFAULT);
+}
+
+/**
+  * @brief  Configure the XSPI in memory-mapped mode with an option.
+  *         BSP_XSPI_MMP_CONTINUOUS_READ keeps the memory in the performance enhance mode of
+  *         4READ: the opcode is sent with the first access only, and the following line
+  *         fills start with the address. It needs the QPI mode with the 4READ command.
+  *         The memory leaves this mode in BSP_XSPI_DisableMemoryMappedMode(), and in
+  *         BSP_XSPI_Init() after a MCU reset. The option cannot be changed while the
+  *         memory-mapped mode is on.
+  * @param  Instance  XSPI instance
+  * @param  Option    Memory-mapped mode option
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_EnableMemoryMappedModeEx(uint32_t Instance, BSP_XSPI_MmpOption_t Option)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check if the instance is supported */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (Option > BSP_XSPI_MMP_CONTINUOUS_READ))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }/* The continuous read is a mode of 4READ */
+  else if ((Option == BSP_XSPI_MMP_CONTINUOUS_READ) &&
+           ((Xspi_Ctx[Instance].InterfaceMode != BSP_XSPI_QPI_MODE) ||
+            ((Xspi_Ctx[Instance].ReadCommand != BSP_XSPI_READ_DEFAULT) &&
+             (Xspi_Ctx[Instance].ReadCommand != BSP_XSPI_READ_4READ))))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }/* The option cannot be changed while the memory-mapped mode is on */
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
+  {
+    ret = BSP_ERROR_XSPI_MMP_LOCK_FAILURE;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+  else
+  {
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+    /* Program the pending data so that it is visible in the memory-mapped window */
+    if (XSPI_WriteCombineFlush(Instance, 0U, MX25R3235F_FLASH_SIZE) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else if (XSPI_EnableMemoryMappedMode(Instance, Option) != BSP_ERROR_NONE)
+#else
+    if (XSPI_EnableMemoryMappedMode(Instance, Option) != BSP_ERROR_NONE)
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else /* Update XSPI context if all operations are well done */
+    {
+      Xspi_Ctx[Instance].IsInitialized = XSPI_ACCESS_MMP;
+      Xspi_Ctx[Instance].MmpOption     = Option;
+#if (USE_BSP_XSPI_ICACHE == 1)
+      /* Cache the window through its alias */
+      ret = XSPI_ICacheEnable(Instance);
+#endif /* (USE_BSP_XSPI_ICACHE == 1) */
+    }
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_ENABLE_MMP, 0U, 0U, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Exit form memory-mapped mode
+  *         Only 1 Instance can running MMP mode. And it will lock system at this mode.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_DisableMemoryMappedMode(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+  else
+  {
+    if (Xspi_Ctx[Instance].IsInitialized != XSPI_ACCESS_MMP)
+    {
+      ret = BSP_ERROR_XSPI_MMP_UNLOCK_FAILURE;
+    }
+#if (USE_BSP_XSPI_STREAM == 1)
+    /* The window is in use by open cursors */
+    else if (Xspi_Stream[Instance].Holds != 0U)
+    {
+      ret = BSP_ERROR_BUSY;
+    }
+#endif /* (USE_BSP_XSPI_STREAM == 1) */
+    /* Abort MMP back to indirect mode */
+    else
+    {
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+      if (Xspi_MmpLeft[Instance] != 0U)
+      {
+        /* Left for an erase or a program: the XSPI is already in indirect mode */
+        Xspi_MmpLeft[Instance] = 0U;
+        Xspi_Ctx[Instance].IsInitialized = XSPI_ACCESS_INDIRECT;
+      }
+      else
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+      {
+        ret = XSPI_DisableMemoryMappedMode(Instance);
+      }
+      Xspi_Ctx[Instance].MmpOption = BSP_XSPI_MMP_DEFAULT;
+#if (USE_BSP_XSPI_ICACHE == 1)
+      /* The alias is no more backed by the window */
+      if (XSPI_ICacheDisable(Instance) != BSP_ERROR_NONE)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+#endif /* (USE_BSP_XSPI_ICACHE == 1) */
+    }
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_DISABLE_MMP, 0U, 0U, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+#if (USE_BSP_XSPI_STREAM == 1)
+/**
+  * @brief  Opens a cursor on a memory area read in place through the memory-mapped window.
+  *         The memory-mapped mode is enabled if needed and held until the last cursor of
+  *         the instance is closed: BSP_XSPI_DisableMemoryMappedMode() and the functions
+  *         leaving the memory-mapped mode return BSP_ERROR_BUSY meanwhile.
+  * @param  Instance  XSPI instance
+  * @param  pCursor   Pointer to the cursor
+  * @param  Address   Start address of the area
+  * @param  Size      Size of the area
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_StreamOpen(uint32_t Instance, BSP_XSPI_Cursor_t *pCursor, uint32_t Address, uint32_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check if the instance is supported */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pCursor == NULL) ||
+      (Address >= MX25R3235F_FLASH_SIZE) || (Size > (MX25R3235F_FLASH_SIZE - Address)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_NONE)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    /* First cursor: enter the memory-mapped mode, unless the application already did */
+    if (Xspi_Ctx[Instance].IsInitialized != XSPI_ACCESS_MMP)
+    {
+      ret = BSP_XSPI_EnableMemoryMappedMode(Instance);
+      Xspi_Stream[Instance].MmpOwner = 1U;
+    }
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+    else
+    {
+      /* BSP_ERROR_BUSY until the end of an erase or a program */
+      ret = XSPI_MmpResume(Instance);
+    }
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+
+    if (ret == BSP_ERROR_NONE)
+    {
+      Xspi_Stream[Instance].Holds++;
+      pCursor->Instance   = Instance;
+      pCursor->Address    = Address;
+      pCursor->EndAddress = Address + Size;
+      pCursor->Open       = BSP_XSPI_CURSOR_OPEN;
+    }
+    else
+    {
+      Xspi_Stream[Instance].MmpOwner = 0U;
+    }
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_STREAM_OPEN, Address, Size, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Gets the next span of the cursor area and advances the cursor after it.
+  *         The span is a pointer in the memory-mapped window (or in its ICACHE alias),
+  *         valid until the cursor is closed. A size of 0 is returned at the end of the area.
+  * @param  pCursor   Pointer to the cursor
+  * @param  MaxSize   Maximum size of the span
+  * @param  ppData    Pointer to the returned span address
+  * @param  pSize     Pointer to the returned span size
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_StreamNext(BSP_XSPI_Cursor_t *pCursor, uint32_t MaxSize, const uint8_t **ppData, uint32_t *pSize)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t size = 0U;
+#if (USE_BSP_XSPI_TRACE == 1)
+  uint32_t instance = (pCursor != NULL) ? pCursor->Instance : XSPI_INSTANCES_NUMBER;
+  uint32_t address  = (pCursor != NULL) ? pCursor->Address : 0U;
+
+  XSPI_TraceStart(instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check if the cursor is open */
+  if ((pCursor == NULL) || (ppData == NULL) || (pSize == NULL) || (pCursor->Open != BSP_XSPI_CURSOR_OPEN) ||
+      (pCursor->Instance >= XSPI_INSTANCES_NUMBER) || (pCursor->Address > pCursor->EndAddress))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    /* The whole area is contiguous in the window: the span is only limited by MaxSize */
+    size = pCursor->EndAddress - pCursor->Address;
+    if (size > MaxSize)
+    {
+      size = MaxSize;
+    }
+
+#if (USE_BSP_XSPI_ICACHE == 1)
+    *ppData = (const uint8_t *)(Xspi_ICacheConfig[pCursor->Instance].BaseAddress + pCursor->Address);
+#else
+    *ppData = (const uint8_t *)(XSPI1_BASE + pCursor->Address);
+#endif /* (USE_BSP_XSPI_ICACHE == 1) */
+    *pSize = size;
+    pCursor->Address += size;
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(instance, BSP_XSPI_TRACE_STREAM_NEXT, address, size, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Closes a cursor. The memory-mapped mode entered by BSP_XSPI_StreamOpen() is
+  *         left when the last cursor of the instance is closed. The cursor is closed
+  *         even if leaving the memory-mapped mode fails: the mode is then left by the
+  *         next last close.
+  * @param  pCursor   Pointer to the cursor
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_StreamClose(BSP_XSPI_Cursor_t *pCursor)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t instance = (pCursor != NULL) ? pCursor->Instance : XSPI_INSTANCES_NUMBER;
+#if (USE_BSP_XSPI_TRACE == 1)
+  uint32_t address  = (pCursor != NULL) ? pCursor->Address : 0U;
+
+  XSPI_TraceStart(instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check if the cursor is open */
+  if ((pCursor == NULL) || (pCursor->Open != BSP_XSPI_CURSOR_OPEN) || (pCursor->Instance >= XSPI_INSTANCES_NUMBER) ||
+      (Xspi_Stream[pCursor->Instance].Holds == 0U))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    pCursor->Instance = XSPI_INSTANCES_NUMBER;
+    pCursor->Open     = 0U;
+    Xspi_Stream[instance].Holds--;
+
+    /* Last cursor: leave the memory-mapped mode if it was entered for the cursors */
+    if ((Xspi_Stream[instance].Holds == 0U) && (Xspi_Stream[instance].MmpOwner != 0U))
+    {
+      ret = BSP_XSPI_DisableMemoryMappedMode(instance);
+      if (ret == BSP_ERROR_NONE)
+      {
+        Xspi_Stream[instance].MmpOwner = 0U;
+      }
+    }
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(instance, BSP_XSPI_TRACE_STREAM_CLOSE, address, 0U, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_STREAM == 1) */
+
+#if (USE_BSP_XSPI_CRC == 1)
+/**
+  * @brief  Computes the CRC-32 (IEEE 802.3, as zlib) of a memory area. The CRC unit is fed
+  *         straight from the memory-mapped window, with no copy in RAM: by words for the
+  *         aligned part of the area, by bytes for its unaligned start and end. The
+  *         memory-mapped mode is enabled for the computation if needed.
+  * @note   The CRC unit is configured at each call and its configuration (polynomial,
+  *         initial value, inversions) is restored at the end, so that it can be shared with
+  *         the application. A CRC being accumulated by the application is lost, and the CRC
+  *         unit must not be used by an interrupt handler meanwhile.
+  * @param  Instance  XSPI instance
+  * @param  Address   Start address of the area
+  * @param  Size      Size of the area
+  * @param  pCrc      Pointer to the returned CRC
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_ComputeCRC(uint32_t Instance, uint32_t Address, uint32_t Size, uint32_t *pCrc)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t mmp_owner = 0U;
+  uint32_t crc_clock;
+  uint32_t crc_cr;
+  uint32_t crc_init;
+  uint32_t crc_pol;
+  uint32_t head;
+  uint32_t body;
+  uint32_t crc;
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check the parameters */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pCrc == NULL) || (Address >= MX25R3235F_FLASH_SIZE) ||
+      (Size > (MX25R3235F_FLASH_SIZE - Address)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_NONE)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    if (Xspi_Ctx[Instance].IsInitialized != XSPI_ACCESS_MMP)
+    {
+      ret = BSP_XSPI_EnableMemoryMappedMode(Instance);
+      mmp_owner = (ret == BSP_ERROR_NONE) ? 1U : 0U;
+    }
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+    else
+    {
+      /* BSP_ERROR_BUSY until the end of an erase or a program */
+      ret = XSPI_MmpResume(Instance);
+    }
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+
+    if (ret == BSP_ERROR_NONE)
+    {
+      /* Save the configuration of the CRC unit */
+      crc_clock = (__HAL_RCC_CRC_IS_CLK_ENABLED() != 0U) ? 1U : 0U;
+      __HAL_RCC_CRC_CLK_ENABLE();
+      crc_cr   = CRC->CR;
+      crc_init = CRC->INIT;
+      crc_pol  = CRC->POL;
+
+      /* CRC-32: default polynomial and init value, reflected input and output, bytes */
+      hcrc_xspi.Instance                     = CRC;
+      hcrc_xspi.Init.DefaultPolynomialUse    = DEFAULT_POLYNOMIAL_ENABLE;
+      hcrc_xspi.Init.DefaultInitValueUse     = DEFAULT_INIT_VALUE_ENABLE;
+      hcrc_xspi.Init.InputDataInversionMode  = CRC_INPUTDATA_INVERSION_BYTE;
+      hcrc_xspi.Init.OutputDataInversionMode = CRC_OUTPUTDATA_INVERSION_ENABLE;
+      hcrc_xspi.InputDataFormat              = CRC_INPUTDATA_FORMAT_BYTES;
+
+      if (HAL_CRC_Init(&hcrc_xspi) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else
+      {
+        /* The uncached window is read: a single pass would only evict the cached code */
+        head = (4U - (Address % 4U)) % 4U;
+        head = (head > Size) ? Size : head;
+        body = (Size - head) & ~3UL;
+
+        /* Unaligned start by bytes */
+        crc = HAL_CRC_Calculate(&hcrc_xspi, (uint32_t *)(XSPI1_BASE + Address), head);
+
+        /* Aligned part by words: the reversal of a whole little endian word keeps the byte order */
+        if (body != 0U)
+        {
+          (void)HAL_CRCEx_Input_Data_Reverse(&hcrc_xspi, CRC_INPUTDATA_INVERSION_WORD);
+          hcrc_xspi.InputDataFormat = CRC_INPUTDATA_FORMAT_WORDS;
+          crc = HAL_CRC_Accumulate(&hcrc_xspi, (uint32_t *)(XSPI1_BASE + Address + head), body / 4U);
+
+          (void)HAL_CRCEx_Input_Data_Reverse(&hcrc_xspi, CRC_INPUTDATA_INVERSION_BYTE);
+          hcrc_xspi.InputDataFormat = CRC_INPUTDATA_FORMAT_BYTES;
+        }
+
+        /* Unaligned end by bytes */
+        if ((head + body) != Size)
+        {
+          crc = HAL_CRC_Accumulate(&hcrc_xspi, (uint32_t *)(XSPI1_BASE + Address + head + body),
+                                   Size - head - body);
+        }
+        *pCrc = crc ^ 0xFFFFFFFFUL;
+      }
+
+      /* Restore the configuration of the CRC unit */
+      CRC->POL  = crc_pol;
+      CRC->INIT = crc_init;
+      CRC->CR   = crc_cr;
+      if (crc_clock == 0U)
+      {
+        __HAL_RCC_CRC_CLK_DISABLE();
+      }
+    }
+
+    /* Leave the memory-mapped mode if it was entered for the computation */
+    if ((mmp_owner != 0U) && (BSP_XSPI_DisableMemoryMappedMode(Instance) != BSP_ERROR_NONE) &&
+        (ret == BSP_ERROR_NONE))
+    {
+      ret = BSP_ERROR_XSPI_MMP_UNLOCK_FAILURE;
+    }
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_COMPUTE_CRC, Address, Size, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+#if defined(HAL_HASH_MODULE_ENABLED)
+/**
+  * @brief  Computes the SHA-256 digest of a memory area. The HASH unit is fed straight from
+  *         the memory-mapped window, with no copy in RAM. The memory-mapped mode is enabled
+  *         for the computation if needed, and the HASH unit is configured at each call then
+  *         de-initialized, with its clock left as found.
+  * @param  Instance  XSPI instance
+  * @param  Address   Start address of the area
+  * @param  Size      Size of the area
+  * @param  pDigest   Pointer to the returned digest, BSP_XSPI_HASH_SIZE bytes
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_ComputeHash(uint32_t Instance, uint32_t Address, uint32_t Size, uint8_t *pDigest)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t mmp_owner = 0U;
+  uint32_t hash_clock;
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check the parameters */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pDigest == NULL) || (Address >= MX25R3235F_FLASH_SIZE) ||
+      (Size > (MX25R3235F_FLASH_SIZE - Address)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_NONE)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    if (Xspi_Ctx[Instance].IsInitialized != XSPI_ACCESS_MMP)
+    {
+      ret = BSP_XSPI_EnableMemoryMappedMode(Instance);
+      mmp_owner = (ret == BSP_ERROR_NONE) ? 1U : 0U;
+    }
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+    else
+    {
+      /* BSP_ERROR_BUSY until the end of an erase or a program */
+      ret = XSPI_MmpResume(Instance);
+    }
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+
+    if (ret == BSP_ERROR_NONE)
+    {
+      /* Save the clock state of the HASH unit */
+      hash_clock = (__HAL_RCC_HASH_IS_CLK_ENABLED() != 0U) ? 1U : 0U;
+      __HAL_RCC_HASH_CLK_ENABLE();
+      hhash_xspi.Instance       = HASH;
+      hhash_xspi.Init.DataType  = HASH_BYTE_SWAP;
+      hhash_xspi.Init.Algorithm = HASH_ALGOSELECTION_SHA256;
+
+      if ((HAL_HASH_Init(&hhash_xspi) != HAL_OK) ||
+          (HAL_HASH_Start(&hhash_xspi, (const uint8_t *)(XSPI1_BASE + Address), Size, pDigest,
+                          XSPI_HASH_TIMEOUT + (Size / XSPI_HASH_BYTES_PER_MS)) != HAL_OK))
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+
+      /* Release the HASH unit and restore its clock state */
+      (void)HAL_HASH_DeInit(&hhash_xspi);
+      if (hash_clock == 0U)
+      {
+        __HAL_RCC_HASH_CLK_DISABLE();
+      }
+    }
+
+    /* Leave the memory-mapped mode if it was entered for the computation */
+    if ((mmp_owner != 0U) && (BSP_XSPI_DisableMemoryMappedMode(Instance) != BSP_ERROR_NONE) &&
+        (ret == BSP_ERROR_NONE))
+    {
+      ret = BSP_ERROR_XSPI_MMP_UNLOCK_FAILURE;
+    }
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_COMPUTE_HASH, Address, Size, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+#endif /* defined(HAL_HASH_MODULE_ENABLED) */
+
+#if (USE_BSP_XSPI_BENCHMARK == 1)
+/**
+  * @brief  Measures the throughput of BSP_XSPI_ComputeCRC() and, when the HAL HASH module
+  *         is enabled, of BSP_XSPI_ComputeHash() on a memory area, memory-mapped mode
+  *         enable and disable included when the instance is not in memory-mapped mode.
+  * @param  Instance  XSPI instance
+  * @param  Address   Start address of the area
+  * @param  Size      Size of the area
+  * @param  pResult   Pointer to the result
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_BenchmarkCRC(uint32_t Instance, uint32_t Address, uint32_t Size, BSP_XSPI_CrcBench_t *pResult)
+{
+  int32_t ret;
+  uint32_t start;
+  uint32_t cycles;
+#if defined(HAL_HASH_MODULE_ENABLED)
+  uint8_t digest[BSP_XSPI_HASH_SIZE];
+#endif /* defined(HAL_HASH_MODULE_ENABLED) */
+
+  /* Check the parameters */
+  if (pResult == NULL)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    /* Enable the cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    pResult->CrcBytesPerSecond  = 0U;
+    pResult->HashBytesPerSecond = 0U;
+
+    start = DWT->CYCCNT;
+    ret = BSP_XSPI_ComputeCRC(Instance, Address, Size, &pResult->Crc);
+    cycles = DWT->CYCCNT - start;
+    if ((ret == BSP_ERROR_NONE) && (cycles != 0U))
+    {
+      pResult->CrcBytesPerSecond = (uint32_t)(((uint64_t)Size * SystemCoreClock) / cycles);
+    }
+
+#if defined(HAL_HASH_MODULE_ENABLED)
+    if (ret == BSP_ERROR_NONE)
+    {
+      start = DWT->CYCCNT;
+      ret = BSP_XSPI_ComputeHash(Instance, Address, Size, digest);
+      cycles = DWT->CYCCNT - start;
+      if ((ret == BSP_ERROR_NONE) && (cycles != 0U))
+      {
+        pResult->HashBytesPerSecond = (uint32_t)(((uint64_t)Size * SystemCoreClock) / cycles);
+      }
+    }
+#endif /* defined(HAL_HASH_MODULE_ENABLED) */
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_BENCHMARK == 1) */
+#endif /* (USE_BSP_XSPI_CRC == 1) */
+
+#if (USE_BSP_XSPI_ICACHE == 1)
+/**
+  * @brief  Sets the ICACHE remap region used for the memory-mapped window. The XSPI window is
+  *         not cached, the code and constants have to be accessed through the region alias.
+  *         The region is set when the memory-mapped mode is enabled, at once if it already is.
+  * @param  Instance  XSPI instance
+  * @param  pConfig   Pointer to the ICACHE region configuration
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_ConfigICache(uint32_t Instance, const BSP_XSPI_ICacheConfig_t *pConfig)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check the parameters */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pConfig == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    Xspi_ICacheConfig[Instance] = *pConfig;
+
+    if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
+    {
+      ret = XSPI_ICacheEnable(Instance);
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Invalidates the ICACHE, to be called when the memory is changed by other means
+  *         than the BSP functions, which invalidate it themselves.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_InvalidateICache(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (HAL_ICACHE_Invalidate() != HAL_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+#if (USE_BSP_XSPI_BENCHMARK == 1)
+/**
+  * @brief  Measures the read time of an area in memory-mapped mode, from the XSPI window
+  *         and from its cached alias, and the ICACHE hits and misses of the cached reads.
+  *         Each measure reads the area XSPI_ICACHE_BENCH_LOOPS times.
+  * @param  Instance  XSPI instance
+  * @param  Address   Start address of the area in the memory, multiple of 4
+  * @param  Size      Size of the area, multiple of 4
+  * @param  pResult   Pointer to the result
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_BenchmarkICache(uint32_t Instance, uint32_t Address, uint32_t Size, BSP_XSPI_ICacheBench_t *pResult)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check the parameters */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pResult == NULL) || ((Address % 4U) != 0U) ||
+      ((Size % 4U) != 0U) || (Address >= MX25R3235F_FLASH_SIZE) || (Size > (MX25R3235F_FLASH_SIZE - Address)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Xspi_Ctx[Instance].IsInitialized != XSPI_ACCESS_MMP)
+  {
+    ret = BSP_ERROR_XSPI_MMP_UNLOCK_FAILURE;
+  }
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+  /* The window cannot be read until the end of an erase or a program */
+  else if (XSPI_MmpResume(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+  else
+  {
+    /* Enable the cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    pResult->UncachedCycles = XSPI_MeasureRead((const uint32_t *)(XSPI1_BASE + Address), Size);
+
+    if ((HAL_ICACHE_Invalidate() != HAL_OK) || (HAL_ICACHE_Monitor_Reset(ICACHE_MONITOR_HIT_MISS) != HAL_OK) ||
+        (HAL_ICACHE_Monitor_Start(ICACHE_MONITOR_HIT_MISS) != HAL_OK))
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      pResult->CachedCycles = XSPI_MeasureRead((const uint32_t *)(Xspi_ICacheConfig[Instance].BaseAddress + Address),
+                                               Size);
+      pResult->Hits   = HAL_ICACHE_Monitor_GetHitValue();
+      pResult->Misses = HAL_ICACHE_Monitor_GetMissValue();
+
+      if (HAL_ICACHE_Monitor_Stop(ICACHE_MONITOR_HIT_MISS) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_BENCHMARK == 1) */
+#endif /* (USE_BSP_XSPI_ICACHE == 1) */
+
+/**
+  * @brief  Get flash ID 3 Bytes:
+  *         Manufacturer ID, Memory type, Memory density
+  * @param  Instance  XSPI instance
+  * @param  Id Pointer to retrieve ID from memory
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_ReadID(uint32_t Instance, uint8_t *Id)
+{
+  int32_t ret;
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+  else if (MX25R3235F_ReadID(&hxspi[Instance], Id) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+    ret = BSP_ERROR_NONE;
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_READ_ID, 0U, 0U, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Set Flash to desired Interface mode. And this instance becomes current instance.
+  *         If current instance running at MMP mode then this function doesn't work.
+  *         Indirect -> Indirect
+  * @param  Instance  XSPI instance
+  * @param  Mode      XSPI mode
+  * @retval BSP status
+  */
+static int32_t XSPI_ConfigFlash(uint32_t Instance, BSP_XSPI_Interface_t Mode)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    /* Check if MMP mode locked ************************************************/
+    if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
+    {
+      ret = BSP_ERROR_XSPI_MMP_LOCK_FAILURE;
+    }
+    else
+    {
+      /* Setup Flash interface ***************************************************/
+      switch (Xspi_Ctx[Instance].InterfaceMode)
+      {
+        case BSP_XSPI_QPI_MODE :  /* 1-4-4 commands */
+          if (Mode != BSP_XSPI_QPI_MODE)
+          {
+            /* Exit QPI mode */
+            ret = XSPI_ExitQPIMode(Instance);
+          }
+          break;
+
+        case BSP_XSPI_SPI_MODE :  /* 1-1-1 commands, Power on H/W default setting */
+        default :
+          if (Mode == BSP_XSPI_QPI_MODE)
+          {
+            /* Enter QPI mode */
+            ret = XSPI_EnterQPIMode(Instance);
+          }
+          break;
+      }
+
+      /* Update XSPI context if all operations are well done */
+      if (ret == BSP_ERROR_NONE)
+      {
+        /* Update current status parameter *****************************************/
+        Xspi_Ctx[Instance].IsInitialized = XSPI_ACCESS_INDIRECT;
+        Xspi_Ctx[Instance].InterfaceMode = Mode;
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  This function suspends an ongoing erase command.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_SuspendErase(uint32_t Instance)
+{
+  int32_t ret;
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+  /* Check whether the device is busy (erase operation is in progress). */
+  else if (BSP_XSPI_GetStatus(Instance) != BSP_ERROR_BUSY)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+#if (USE_BSP_XSPI_STATS == 1)
+    /* WIP cleared by the suspend is not the end of the measured erase */
+    XSPI_StatsEraseSuspend(Instance, 1U);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+
+    if (MX25R3235F_Suspend(&hxspi[Instance]) != MX25R3235F_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    /* The memory can be read once WIP is cleared, at the end of the suspend latency (tESL) */
+    else if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else if (BSP_XSPI_GetStatus(Instance) != BSP_ERROR_XSPI_SUSPENDED)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      ret = BSP_ERROR_NONE;
+    }
+
+#if (USE_BSP_XSPI_STATS == 1)
+    if (ret != BSP_ERROR_NONE)
+    {
+      XSPI_StatsEraseSuspend(Instance, 0U);
+    }
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_SUSPEND_ERASE, 0U, 0U, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  This function resumes a paused erase command.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_ResumeErase(uint32_t Instance)
+{
+  int32_t ret;
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+  /* Check whether the device is busy (erase operation is in progress). */
+  else if (BSP_XSPI_GetStatus(Instance) != BSP_ERROR_XSPI_SUSPENDED)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if (MX25R3235F_Resume(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  /*
+  When this command is executed, the status register write in progress bit is set to 1, and
+  the flag status register program erase controller bit is set to 0. This command is ignored
+  if the device is not in a suspended state.
+  */
+  else if (BSP_XSPI_GetStatus(Instance) != BSP_ERROR_BUSY)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+#if (USE_BSP_XSPI_STATS == 1)
+    XSPI_StatsEraseSuspend(Instance, 0U);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+    ret = BSP_ERROR_NONE;
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_RESUME_ERASE, 0U, 0U, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  This function suspends an ongoing program command.
+  * @note   The memory can be read once this function returns. Until BSP_XSPI_ResumeProgram(),
+  *         the functions programming the memory, including the write combining flush done by
+  *         a read of the pending page, return an error.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_SuspendProgram(uint32_t Instance)
+{
+  int32_t ret;
+  uint8_t reg[1];
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+  /* Check whether the device is busy (program operation is in progress). */
+  else if (BSP_XSPI_GetStatus(Instance) != BSP_ERROR_BUSY)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if (MX25R3235F_Suspend(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  /* The memory can be read once WIP is cleared, at the end of the suspend latency (tPSL) */
+  else if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if (MX25R3235F_ReadSecurityRegister(&hxspi[Instance], reg) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }/* The same command suspends an erase: check that a program was suspended */
+  else if ((reg[0] & MX25R3235F_SECR_PSB) == 0U)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+    /* Programs are rejected until the resume */
+    Xspi_ProgramSuspended[Instance] = 1U;
+    ret = BSP_ERROR_NONE;
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_SUSPEND_PROGRAM, 0U, 0U, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  This function resumes a paused program command.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_ResumeProgram(uint32_t Instance)
+{
+  int32_t ret;
+  uint8_t reg[1];
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+  else if (MX25R3235F_ReadSecurityRegister(&hxspi[Instance], reg) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }/* Check whether a program is suspended */
+  else if ((reg[0] & MX25R3235F_SECR_PSB) == 0U)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if (MX25R3235F_Resume(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+    Xspi_ProgramSuspended[Instance] = 0U;
+
+    /* The program goes on (WIP set) or is already completed, it must not be suspended or failed */
+    ret = BSP_XSPI_GetStatus(Instance);
+    if ((ret != BSP_ERROR_BUSY) && (ret != BSP_ERROR_NONE))
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      ret = BSP_ERROR_NONE;
+    }
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_RESUME_PROGRAM, 0U, 0U, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Switches the memory between its ultra low power and high performance modes, and
+  *         sets the XSPI clock prescaler to the fastest clock of the mode: BSP_XSPI_ULP_PRESCALER
+  *         or BSP_XSPI_HP_PRESCALER. The on-going program or erase is completed first. When
+  *         speeding up, the memory is switched before the clock, and the other way round
+  *         when slowing down, so that the memory is never clocked above its limit.
+  * @note   The delay block is set back to its default phase: a calibration done with
+  *         BSP_XSPI_Calibrate() has to be done again for the new clock.
+  * @param  Instance  XSPI instance
+  * @param  Mode      Performance mode of the memory
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_SetPerformanceMode(uint32_t Instance, BSP_XSPI_PerformanceMode_t Mode)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  BSP_XSPI_Calibration_t timing;
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check the parameters */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (Mode > BSP_XSPI_HIGH_PERFORMANCE_MODE))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+  /* Wake up the memory if it is in deep power-down */
+  else if (XSPI_PowerAccess(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_NONE)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else if (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP)
+  {
+    ret = BSP_ERROR_XSPI_MMP_LOCK_FAILURE;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_SCHEDULER == 1)
+  /* Check if a scheduled erase or program is on-going */
+  else if (Xspi_Scheduler[Instance].pBusy != NULL)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_SCHEDULER == 1) */
+  else
+  {
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+    /* Program the pending data at the current clock */
+    ret = XSPI_WriteCombineFlush(Instance, 0U, MX25R3235F_FLASH_SIZE);
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+
+    /* Wait for the end of the on-going operation */
+    if ((ret == BSP_ERROR_NONE) &&
+        (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE))
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+
+    /* The configuration register cannot be written while an operation is suspended */
+    if ((ret == BSP_ERROR_NONE) && (BSP_XSPI_GetStatus(Instance) == BSP_ERROR_XSPI_SUSPENDED))
+    {
+      ret = BSP_ERROR_BUSY;
+    }
+
+    if (ret == BSP_ERROR_NONE)
+    {
+      XSPI_GetTiming(Instance, &timing);
+      timing.ClockPrescaler = (Mode == BSP_XSPI_HIGH_PERFORMANCE_MODE) ? BSP_XSPI_HP_PRESCALER :
+                              BSP_XSPI_ULP_PRESCALER;
+      timing.DlybPhaseSel   = 0U;
+
+      if (Mode == BSP_XSPI_HIGH_PERFORMANCE_MODE)
+      {
+        ret = XSPI_SetPowerMode(Instance, Mode);
+        if (ret == BSP_ERROR_NONE)
+        {
+          ret = XSPI_ApplyTiming(Instance, &timing);
+        }
+      }
+      else
+      {
+        ret = XSPI_ApplyTiming(Instance, &timing);
+        if (ret == BSP_ERROR_NONE)
+        {
+          ret = XSPI_SetPowerMode(Instance, Mode);
+        }
+      }
+    }
+  }
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_SET_PERFORMANCE_MODE, 0U, (uint32_t)Mode, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Returns the current performance mode of the memory.
+  * @param  Instance  XSPI instance
+  * @param  pMode     Pointer to the performance mode
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_GetPerformanceMode(uint32_t Instance, BSP_XSPI_PerformanceMode_t *pMode)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check the parameters */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pMode == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    *pMode = Xspi_Ctx[Instance].PerformanceMode;
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  This function enter the XSPI memory in deep power down mode.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_EnterDeepPowerDown(uint32_t Instance)
+{
+  int32_t ret;
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+  else if (MX25R3235F_EnterPowerDown(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+    /* The next access wakes the memory up */
+    XSPI_PowerSetState(Instance, 1U);
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+    ret = BSP_ERROR_NONE;
+  }
+
+  /* ---          Memory takes 10us max to enter deep power down          --- */
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_ENTER_POWER_DOWN, 0U, 0U, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  This function leave the XSPI memory from deep power down mode.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_LeaveDeepPowerDown(uint32_t Instance)
+{
+  int32_t ret;
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStart(Instance);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Check if an asynchronous operation is on-going */
+  else if (XSPI_AsyncCheck(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+  else if (MX25R3235F_NoOperation(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+    /* Wait for the memory to be ready for the next command */
+    XSPI_DelayUs(XSPI_NOR_DP_WAKE_US);
+    XSPI_PowerSetState(Instance, 0U);
+    Xspi_Power[Instance].LastAccess = HAL_GetTick();
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+    ret = BSP_ERROR_NONE;
+  }
+
+  /* --- A NOP command is sent to the memory, as the nCS should be low for at least 20 ns --- */
+  /* ---                  Memory takes 30us min to leave deep power down                  --- */
+
+#if (USE_BSP_XSPI_TRACE == 1)
+  XSPI_TraceStop(Instance, BSP_XSPI_TRACE_LEAVE_POWER_DOWN, 0U, 0U, ret);
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+/**
+  * @brief  Get the time spent by the memory in each power state since the last reset of
+  *         the statistics, and the number of wake-ups from deep power-down.
+  * @param  Instance  XSPI instance
+  * @param  pStats    Pointer to the power statistics
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_GetPowerStats(uint32_t Instance, BSP_XSPI_PowerStats_t *pStats)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t elapsed;
+
+  /* Check the parameters */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pStats == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    *pStats = Xspi_Power[Instance].Stats;
+
+    /* Count the current state up to now */
+    elapsed = HAL_GetTick() - Xspi_Power[Instance].StateTick;
+    if (Xspi_Power[Instance].PowerDown != 0U)
+    {
+      pStats->PowerDownTime += elapsed;
+    }
+    else
+    {
+      pStats->ActiveTime += elapsed;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Reset the power statistics.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_ResetPowerStats(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    Xspi_Power[Instance].Stats.ActiveTime    = 0U;
+    Xspi_Power[Instance].Stats.PowerDownTime = 0U;
+    Xspi_Power[Instance].Stats.WakeUps       = 0U;
+    Xspi_Power[Instance].StateTick           = HAL_GetTick();
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+
+#if (USE_BSP_XSPI_STATS == 1)
+/**
+  * @brief  Get the per-operation statistics of the read, write and erase functions.
+  * @param  Instance  XSPI instance
+  * @param  pStats    Pointer to the statistics
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_GetStats(uint32_t Instance, BSP_XSPI_Stats_t *pStats)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t primask;
+
+  /* Check the parameters */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pStats == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    /* The statistics of the asynchronous operations are updated in interrupt context */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    *pStats = Xspi_Stats[Instance].Stats;
+    __set_PRIMASK(primask);
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Reset the per-operation statistics.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_ResetStats(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t primask;
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    (void)memset(&Xspi_Stats[Instance].Stats, 0, sizeof(BSP_XSPI_Stats_t));
+    __set_PRIMASK(primask);
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+
+#if (USE_BSP_XSPI_TRACE == 1)
+/**
+  * @brief  Get the records of the trace ring, oldest first.
+  * @param  Instance    XSPI instance
+  * @param  pRecords    Pointer to the records array
+  * @param  MaxRecords  Size of the records array
+  * @param  pNbRecords  Pointer to the number of returned records
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_GetTrace(uint32_t Instance, BSP_XSPI_TraceRecord_t *pRecords, uint32_t MaxRecords,
+                          uint32_t *pNbRecords)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t count;
+  uint32_t first;
+  uint32_t index;
+
+  /* Check the parameters */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || (pRecords == NULL) || (pNbRecords == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    count = (Xspi_Trace[Instance].Count < BSP_XSPI_TRACE_DEPTH) ? Xspi_Trace[Instance].Count : BSP_XSPI_TRACE_DEPTH;
+    if (count > MaxRecords)
+    {
+      count = MaxRecords;
+    }
+    first = Xspi_Trace[Instance].Count - count;
+
+    for (index = 0U; index < count; index++)
+    {
+      pRecords[index] = Xspi_Trace[Instance].Records[(first + index) % BSP_XSPI_TRACE_DEPTH];
+    }
+    *pNbRecords = count;
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Empty the trace ring.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_ResetTrace(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= XSPI_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    Xspi_Trace[Instance].Count = 0U;
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+#if (USE_BSP_COM_FEATURE == 1)
+/**
+  * @brief  Send the trace ring on a COM port, in binary: a BSP_XSPI_TraceHeader_t followed
+  *         by the BSP_XSPI_TraceRecord_t records, oldest first, in little endian.
+  * @note   The COM port must be initialized with BSP_COM_Init().
+  * @param  Instance  XSPI instance
+  * @param  COM       COM port
+  * @retval BSP status
+  */
+int32_t BSP_XSPI_DumpTrace(uint32_t Instance, COM_TypeDef COM)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  BSP_XSPI_TraceHeader_t header;
+  BSP_XSPI_TraceRecord_t record;
+  uint32_t first;
+  uint32_t index;
+
+  /* Check the parameters */
+  if ((Instance >= XSPI_INSTANCES_NUMBER) || ((uint32_t)COM >= COMn))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    header.Magic      = BSP_XSPI_TRACE_MAGIC;
+    header.Version    = BSP_XSPI_TRACE_VERSION;
+    header.RecordSize = (uint16_t)sizeof(BSP_XSPI_TraceRecord_t);
+    header.NbRecords  = (Xspi_Trace[Instance].Count < BSP_XSPI_TRACE_DEPTH) ? Xspi_Trace[Instance].Count :
+                        BSP_XSPI_TRACE_DEPTH;
+    header.CoreClock  = SystemCoreClock;
+    first = Xspi_Trace[Instance].Count - header.NbRecords;
+
+    if (HAL_UART_Transmit(&hcom_uart[COM], (uint8_t *)&header, (uint16_t)sizeof(header),
+                          XSPI_TRACE_COM_TIMEOUT) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+
+    for (index = 0U; (index < header.NbRecords) && (ret == BSP_ERROR_NONE); index++)
+    {
+      /* Copy first: the ring can be written by a BSP call from an interrupt meanwhile */
+      record = Xspi_Trace[Instance].Records[(first + index) % BSP_XSPI_TRACE_DEPTH];
+      if (HAL_UART_Transmit(&hcom_uart[COM], (uint8_t *)&record, (uint16_t)sizeof(record),
+                            XSPI_TRACE_COM_TIMEOUT) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+#endif /* (USE_BSP_COM_FEATURE == 1) */
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+/**
+  * @brief  Handles XSPI interrupt request.
+  * @param  Instance  XSPI instance
+  * @retval None
+  */
+void BSP_XSPI_IRQHandler(uint32_t Instance)
+{
+  HAL_XSPI_IRQHandler(&hxspi[Instance]);
+}
+
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+/**
+  * @brief  Handles XSPI DMA receive channel interrupt request.
+  * @param  Instance  XSPI instance
+  * @retval None
+  */
+void BSP_XSPI_DMA_RX_IRQHandler(uint32_t Instance)
+{
+  HAL_DMA_IRQHandler(hxspi[Instance].hdmarx);
+}
+
+/**
+  * @brief  Handles XSPI DMA transmit channel interrupt request.
+  * @param  Instance  XSPI instance
+  * @retval None
+  */
+void BSP_XSPI_DMA_TX_IRQHandler(uint32_t Instance)
+{
+  HAL_DMA_IRQHandler(hxspi[Instance].hdmatx);
+}
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+
+#if (USE_HAL_XSPI_REGISTER_CALLBACKS == 0)
+/**
+  * @brief  Status match callback.
+  * @param  hxspi XSPI handle
+  * @retval None
+  */
+void HAL_XSPI_StatusMatchCallback(XSPI_HandleTypeDef *hxspi)
+{
+  XSPI_StatusMatchCallback(hxspi);
+}
+
+/**
+  * @brief  Command complete callback.
+  * @param  hxspi XSPI handle
+  * @retval None
+  */
+void HAL_XSPI_CmdCpltCallback(XSPI_HandleTypeDef *hxspi)
+{
+  XSPI_CmdCpltCallback(hxspi);
+}
+
+/**
+  * @brief  Tx transfer complete callback.
+  * @param  hxspi XSPI handle
+  * @retval None
+  */
+void HAL_XSPI_TxCpltCallback(XSPI_HandleTypeDef *hxspi)
+{
+  XSPI_TxCpltCallback(hxspi);
+}
+
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+/**
+  * @brief  Rx transfer complete callback.
+  * @param  hxspi XSPI handle
+  * @retval None
+  */
+void HAL_XSPI_RxCpltCallback(XSPI_HandleTypeDef *hxspi)
+{
+  XSPI_RxCpltCallback(hxspi);
+}
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+
+/**
+  * @brief  Transfer error callback.
+  * @param  hxspi XSPI handle
+  * @retval None
+  */
+void HAL_XSPI_ErrorCallback(XSPI_HandleTypeDef *hxspi)
+{
+  XSPI_ErrorCallback(hxspi);
+}
+#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS == 0) */
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+/**
+  * @}
+  */
+
+/** @addtogroup STM32WBAXX_NUCLEO_XSPI_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initializes the XSPI MSP.
+  * @param  hxspi XSPI handle
+  * @retval None
   */
 static void XSPI_MspInit(XSPI_HandleTypeDef *hxspi)
 {
-  GPIO_InitTypeDef GPIO_InitStruct;
+  GPIO_InitTypeDef GPIO_InitStruct;
+
+  /* hxspi unused argument(s) compilation warning */
+  UNUSED(hxspi);
+
+  /* Enable the XSPI memory interface clock */
+  XSPI_CLK_ENABLE();
+
+  /* Reset the XSPI memory interface */
+  XSPI_FORCE_RESET();
+  XSPI_RELEASE_RESET();
+
+  /* Enable GPIO clocks */
+  XSPI_CLK_GPIO_CLK_ENABLE();
+  XSPI_CS_GPIO_CLK_ENABLE();
+  XSPI_D0_GPIO_CLK_ENABLE();
+  XSPI_D1_GPIO_CLK_ENABLE();
+  XSPI_D2_GPIO_CLK_ENABLE();
+  XSPI_D3_GPIO_CLK_ENABLE();
+
+  /* XSPI CS GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = XSPI_CS_PIN;
+  GPIO_InitStruct.Mode      = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Pull      = GPIO_PULLUP;
+  GPIO_InitStruct.Speed     = GPIO_SPEED_FREQ_HIGH;
+  GPIO_InitStruct.Alternate = XSPI_CS_PIN_AF;
+  HAL_GPIO_Init(XSPI_CS_GPIO_PORT, &GPIO_InitStruct);
+
+  /* XSPI CLK GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = XSPI_CLK_PIN;
+  GPIO_InitStruct.Pull      = GPIO_NOPULL;
+  GPIO_InitStruct.Alternate = XSPI_CLK_PIN_AF;
+  HAL_GPIO_Init(XSPI_CLK_GPIO_PORT, &GPIO_InitStruct);
+
+  /* XSPI D0 GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = XSPI_D0_PIN;
+  GPIO_InitStruct.Alternate = XSPI_D0_PIN_AF;
+  HAL_GPIO_Init(XSPI_D0_GPIO_PORT, &GPIO_InitStruct);
+
+  /* XSPI D1 GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = XSPI_D1_PIN;
+  GPIO_InitStruct.Alternate = XSPI_D1_PIN_AF;
+  HAL_GPIO_Init(XSPI_D1_GPIO_PORT, &GPIO_InitStruct);
+
+  /* XSPI D2 GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = XSPI_D2_PIN;
+  GPIO_InitStruct.Alternate = XSPI_D2_PIN_AF;
+  HAL_GPIO_Init(XSPI_D2_GPIO_PORT, &GPIO_InitStruct);
+
+  /* XSPI D3 GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = XSPI_D3_PIN;
+  GPIO_InitStruct.Alternate = XSPI_D3_PIN_AF;
+  HAL_GPIO_Init(XSPI_D3_GPIO_PORT, &GPIO_InitStruct);
+
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+  /* Enable the DMA clock */
+  XSPI_DMA_CLK_ENABLE();
+
+  /* XSPI DMA receive channel configuration */
+  hdma_xspi_rx.Instance                   = XSPI_DMA_RX_CHANNEL;
+  hdma_xspi_rx.Init.Request               = XSPI_DMA_REQUEST;
+  hdma_xspi_rx.Init.BlkHWRequest          = DMA_BREQ_SINGLE_BURST;
+  hdma_xspi_rx.Init.Direction             = DMA_PERIPH_TO_MEMORY;
+  hdma_xspi_rx.Init.SrcInc                = DMA_SINC_FIXED;
+  hdma_xspi_rx.Init.DestInc               = DMA_DINC_INCREMENTED;
+  hdma_xspi_rx.Init.SrcDataWidth          = DMA_SRC_DATAWIDTH_BYTE;
+  hdma_xspi_rx.Init.DestDataWidth         = DMA_DEST_DATAWIDTH_BYTE;
+  hdma_xspi_rx.Init.Priority              = DMA_LOW_PRIORITY_HIGH_WEIGHT;
+  hdma_xspi_rx.Init.SrcBurstLength        = BSP_XSPI_DMA_FIFO_THRESHOLD;
+  hdma_xspi_rx.Init.DestBurstLength       = BSP_XSPI_DMA_FIFO_THRESHOLD;
+  hdma_xspi_rx.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT1;
+  hdma_xspi_rx.Init.TransferEventMode     = DMA_TCEM_BLOCK_TRANSFER;
+  hdma_xspi_rx.Init.Mode                  = DMA_NORMAL;
+  (void)HAL_DMA_Init(&hdma_xspi_rx);
+  __HAL_LINKDMA(hxspi, hdmarx, hdma_xspi_rx);
+
+  /* XSPI DMA transmit channel configuration */
+  hdma_xspi_tx.Instance                   = XSPI_DMA_TX_CHANNEL;
+  hdma_xspi_tx.Init.Request               = XSPI_DMA_REQUEST;
+  hdma_xspi_tx.Init.BlkHWRequest          = DMA_BREQ_SINGLE_BURST;
+  hdma_xspi_tx.Init.Direction             = DMA_MEMORY_TO_PERIPH;
+  hdma_xspi_tx.Init.SrcInc                = DMA_SINC_INCREMENTED;
+  hdma_xspi_tx.Init.DestInc               = DMA_DINC_FIXED;
+  hdma_xspi_tx.Init.SrcDataWidth          = DMA_SRC_DATAWIDTH_BYTE;
+  hdma_xspi_tx.Init.DestDataWidth         = DMA_DEST_DATAWIDTH_BYTE;
+  hdma_xspi_tx.Init.Priority              = DMA_LOW_PRIORITY_HIGH_WEIGHT;
+  hdma_xspi_tx.Init.SrcBurstLength        = BSP_XSPI_DMA_FIFO_THRESHOLD;
+  hdma_xspi_tx.Init.DestBurstLength       = BSP_XSPI_DMA_FIFO_THRESHOLD;
+  hdma_xspi_tx.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT1 | DMA_DEST_ALLOCATED_PORT0;
+  hdma_xspi_tx.Init.TransferEventMode     = DMA_TCEM_BLOCK_TRANSFER;
+  hdma_xspi_tx.Init.Mode                  = DMA_NORMAL;
+  (void)HAL_DMA_Init(&hdma_xspi_tx);
+  __HAL_LINKDMA(hxspi, hdmatx, hdma_xspi_tx);
+
+  /* Configure the NVIC for XSPI DMA channels */
+  HAL_NVIC_SetPriority(XSPI_DMA_RX_IRQn, BSP_XSPI_IT_PRIORITY, 0x00);
+  HAL_NVIC_EnableIRQ(XSPI_DMA_RX_IRQn);
+  HAL_NVIC_SetPriority(XSPI_DMA_TX_IRQn, BSP_XSPI_IT_PRIORITY, 0x00);
+  HAL_NVIC_EnableIRQ(XSPI_DMA_TX_IRQn);
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Configure the NVIC for XSPI */
+  HAL_NVIC_SetPriority(XSPI_IRQn, BSP_XSPI_IT_PRIORITY, 0x00);
+  HAL_NVIC_EnableIRQ(XSPI_IRQn);
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+}
+
+/**
+  * @brief  De-Initializes the XSPI MSP.
+  * @param  hxspi XSPI handle
+  * @retval None
+  */
+static void XSPI_MspDeInit(XSPI_HandleTypeDef *hxspi)
+{
+  /* hxspi unused argument(s) compilation warning */
+  UNUSED(hxspi);
+
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  /* Disable the NVIC for XSPI */
+  HAL_NVIC_DisableIRQ(XSPI_IRQn);
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+  /* De-configure the XSPI DMA channels */
+  HAL_NVIC_DisableIRQ(XSPI_DMA_RX_IRQn);
+  HAL_NVIC_DisableIRQ(XSPI_DMA_TX_IRQn);
+  (void)HAL_DMA_DeInit(&hdma_xspi_rx);
+  (void)HAL_DMA_DeInit(&hdma_xspi_tx);
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+
+  /* XSPI GPIO pins de-configuration  */
+  HAL_GPIO_DeInit(XSPI_CLK_GPIO_PORT, XSPI_CLK_PIN);
+  HAL_GPIO_DeInit(XSPI_CS_GPIO_PORT, XSPI_CS_PIN);
+  HAL_GPIO_DeInit(XSPI_D0_GPIO_PORT, XSPI_D0_PIN);
+  HAL_GPIO_DeInit(XSPI_D1_GPIO_PORT, XSPI_D1_PIN);
+  HAL_GPIO_DeInit(XSPI_D2_GPIO_PORT, XSPI_D2_PIN);
+  HAL_GPIO_DeInit(XSPI_D3_GPIO_PORT, XSPI_D3_PIN);
+
+  /* Reset the XSPI memory interface */
+  XSPI_FORCE_RESET();
+  XSPI_RELEASE_RESET();
+
+  /* Disable the XSPI memory interface clock */
+  XSPI_CLK_DISABLE();
+}
+
+/**
+  * @brief  Checks the read and program commands given at init. The quad commands need the
+  *         QE bit set by the QPI mode, and dummy cycles other than 0 must be between the
+  *         datasheet count of the read command and the largest count of the XSPI.
+  * @param  Init  XSPI InitEx structure
+  * @retval BSP status
+  */
+static int32_t XSPI_CheckCommands(const BSP_XSPI_InitEx_t *Init)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  BSP_XSPI_ReadCommand_t command = Init->ReadCommand;
+  uint32_t min_dummy;
+  uint32_t max_dummy = XSPI_NOR_DUMMY_MAX;
+
+  if (command == BSP_XSPI_READ_DEFAULT)
+  {
+    command = (Init->InterfaceMode == BSP_XSPI_QPI_MODE) ? BSP_XSPI_READ_4READ : BSP_XSPI_READ_FAST;
+  }
+
+  switch (command)
+  {
+    case BSP_XSPI_READ_DREAD :
+      min_dummy = XSPI_NOR_DUMMY_DREAD;
+      break;
+
+    case BSP_XSPI_READ_2READ :
+      min_dummy = XSPI_NOR_DUMMY_2READ;
+      break;
+
+    case BSP_XSPI_READ_QREAD :
+      min_dummy = XSPI_NOR_DUMMY_QREAD;
+      break;
+
+    case BSP_XSPI_READ_4READ :
+      /* The dummy cycles given at init count the mode bits cycles */
+      min_dummy = XSPI_NOR_DUMMY_4READ + XSPI_NOR_DUMMY_MODE_BITS;
+      max_dummy = XSPI_NOR_DUMMY_MAX + XSPI_NOR_DUMMY_MODE_BITS;
+      break;
+
+    default :
+      min_dummy = XSPI_NOR_DUMMY_FAST_READ;
+      break;
+  }
+
+  if ((Init->ReadCommand > BSP_XSPI_READ_4READ) ||
+      (((Init->ReadCommand == BSP_XSPI_READ_QREAD) || (Init->ReadCommand == BSP_XSPI_READ_4READ)) &&
+       (Init->InterfaceMode != BSP_XSPI_QPI_MODE)) ||
+      ((Init->DummyCycles != 0U) && ((Init->DummyCycles < min_dummy) || (Init->DummyCycles > max_dummy))) ||
+      (Init->ProgramCommand > BSP_XSPI_PROGRAM_4PP) ||
+      ((Init->ProgramCommand == BSP_XSPI_PROGRAM_4PP) && (Init->InterfaceMode != BSP_XSPI_QPI_MODE)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  This function reset the XSPI memory.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static int32_t XSPI_ResetMemory(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Exit the continuous read that a MCU reset may have left on */
+  if (XSPI_ExitContinuousRead(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else if (MX25R3235F_ResetEnable(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if (MX25R3235F_ResetMemory(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+    Xspi_Ctx[Instance].IsInitialized = XSPI_ACCESS_INDIRECT;     /* After reset S/W setting to indirect access  */
+    Xspi_Ctx[Instance].InterfaceMode = BSP_XSPI_SPI_MODE;    /* After reset H/W back to SPI mode by default */
+
+    /* Wait SWreset CMD is effective and check that memory is ready */
+    if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  This function enables the quad mode of the memory.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static int32_t XSPI_EnterQPIMode(uint32_t Instance)
+{
+  uint8_t reg;
+
+  if (MX25R3235F_ReadStatusRegister(&hxspi[Instance], &reg) != MX25R3235F_OK)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  /* Enable write operations */
+  if (MX25R3235F_WriteEnable(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  /* Activate/deactivate the Quad mode */
+  SET_BIT(reg, MX25R3235F_SR_QE);
+
+  if (MX25R3235F_WriteStatusRegister(&hxspi[Instance], reg) != MX25R3235F_OK)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  /* Wait that memory is ready */
+  if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  if (MX25R3235F_ReadStatusRegister(&hxspi[Instance], &reg) != MX25R3235F_OK)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  if ((reg & MX25R3235F_SR_QE) == 0)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  This function disables the quad mode of the memory.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static int32_t XSPI_ExitQPIMode(uint32_t Instance)
+{
+  uint8_t reg;
+
+  if (MX25R3235F_ReadStatusRegister(&hxspi[Instance], &reg) != MX25R3235F_OK)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  /* Enable write operations */
+  if (MX25R3235F_WriteEnable(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  /* Activate/deactivate the Quad mode */
+  CLEAR_BIT(reg, MX25R3235F_SR_QE);
+
+  if (MX25R3235F_WriteStatusRegister(&hxspi[Instance], reg) != MX25R3235F_OK)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  /* Wait that memory is ready */
+  if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  if (MX25R3235F_ReadStatusRegister(&hxspi[Instance], &reg) != MX25R3235F_OK)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  if ((reg & MX25R3235F_SR_QE) != 0U)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  This function reads the two bytes of the configuration register of the memory.
+  * @param  Instance  XSPI instance
+  * @param  pReg      Pointer to the configuration register 1 and 2 values
+  * @retval BSP status
+  */
+static int32_t XSPI_ReadConfigRegister(uint32_t Instance, uint8_t *pReg)
+{
+  XSPI_RegularCmdTypeDef s_command = {0};
+
+  XSPI_InitCommand(&s_command, XSPI_NOR_CMD_RDCR);
+  s_command.DataMode   = HAL_XSPI_DATA_1_LINE;
+  s_command.DataLength = 2U;
+
+  if (HAL_XSPI_Command(&hxspi[Instance], &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  if (HAL_XSPI_Receive(&hxspi[Instance], pReg, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  This function sets the power mode of the memory with the L/H switch bit of
+  *         the configuration register 2.
+  * @param  Instance  XSPI instance
+  * @param  Mode      Performance mode of the memory
+  * @retval BSP status
+  */
+static int32_t XSPI_SetPowerMode(uint32_t Instance, BSP_XSPI_PerformanceMode_t Mode)
+{
+  XSPI_RegularCmdTypeDef s_command = {0};
+  uint8_t reg[3];
+
+  /* The status register is written with the configuration register: keep its value */
+  if (MX25R3235F_ReadStatusRegister(&hxspi[Instance], &reg[0]) != MX25R3235F_OK)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  if (XSPI_ReadConfigRegister(Instance, &reg[1]) != BSP_ERROR_NONE)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  if (Mode == BSP_XSPI_HIGH_PERFORMANCE_MODE)
+  {
+    SET_BIT(reg[2], XSPI_NOR_CR2_LH_SWITCH);
+  }
+  else
+  {
+    CLEAR_BIT(reg[2], XSPI_NOR_CR2_LH_SWITCH);
+  }
+
+  /* Enable write operations */
+  if (MX25R3235F_WriteEnable(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  XSPI_InitCommand(&s_command, XSPI_NOR_CMD_WRSR);
+  s_command.DataMode   = HAL_XSPI_DATA_1_LINE;
+  s_command.DataLength = 3U;
+
+  if (HAL_XSPI_Command(&hxspi[Instance], &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  if (HAL_XSPI_Transmit(&hxspi[Instance], reg, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  /* Wait that memory is ready */
+  if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  if (XSPI_ReadConfigRegister(Instance, &reg[1]) != BSP_ERROR_NONE)
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  if (((reg[2] & XSPI_NOR_CR2_LH_SWITCH) != 0U) != (Mode == BSP_XSPI_HIGH_PERFORMANCE_MODE))
+  {
+    return BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  Xspi_Ctx[Instance].PerformanceMode = Mode;
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  This function enables delay block.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static void XSPI_DLYB_Enable(uint32_t Instance)
+{
+  HAL_XSPI_DLYB_CfgTypeDef  dlyb_cfg;
+
+  (void)HAL_XSPI_DLYB_GetClockPeriod(&hxspi[Instance], &dlyb_cfg);
+
+  /* PhaseSel is divided by 4 (emperic value)*/
+  dlyb_cfg.PhaseSel /= 4U;
+
+  /*set delay block configuration*/
+  (void)HAL_XSPI_DLYB_SetConfig(&hxspi[Instance], &dlyb_cfg);
+}
+
+/**
+  * @brief  Polling WIP(Write In Progress) bit become to 0
+  *         When USE_BSP_XSPI_IT_FEATURE is set, the polling is done by the XSPI
+  *         status-match auto-polling and the core sleeps until the match interrupt.
+  *         From an interrupt handler or with the interrupts masked, the match interrupt
+  *         cannot be taken: the status register is then read in a loop.
+  * @param  Instance  XSPI instance
+  * @param  Timeout   Timeout duration in ms
+  * @retval BSP status
+  */
+static int32_t XSPI_AutoPollingMemReady(uint32_t Instance, uint32_t Timeout)
+{
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t primask;
+
+  if ((__get_IPSR() != 0U) || (__get_PRIMASK() != 0U))
+  {
+    return XSPI_PollingMemReady(Instance, Timeout);
+  }
+
+  Xspi_PollStatus[Instance] = BSP_ERROR_BUSY;
+
+  if (XSPI_StartAutoPolling(Instance, Timeout) != BSP_ERROR_NONE)
+  {
+    return BSP_ERROR_PERIPH_FAILURE;
+  }
+#if (USE_BSP_XSPI_STATS == 1)
+  /* Status reads are done by the XSPI: count the auto-polling runs */
+  Xspi_Stats[Instance].Stats.Polls++;
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+
+  /* Sleep until the status match interrupt (any other interrupt also wakes up the core).
+     The status is checked with the interrupts masked: a match between the check and
+     the WFI stays pending, wakes up the core and is taken when they are unmasked */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  while (Xspi_PollStatus[Instance] == BSP_ERROR_BUSY)
+  {
+    if ((HAL_GetTick() - tickstart) > Timeout)
+    {
+      __set_PRIMASK(primask);
+      (void)HAL_XSPI_Abort(&hxspi[Instance]);
+#if (USE_BSP_XSPI_STATS == 1)
+      Xspi_Stats[Instance].Stats.PollTimeouts++;
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+      return BSP_ERROR_COMPONENT_FAILURE;
+    }
+    __WFI();
+    __set_PRIMASK(primask);
+    __disable_irq();
+  }
+  __set_PRIMASK(primask);
+
+#if (USE_BSP_XSPI_STATS == 1)
+  if (Xspi_PollStatus[Instance] == BSP_ERROR_NONE)
+  {
+    XSPI_StatsEraseEnd(Instance, BSP_ERROR_NONE);
+  }
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+
+  return Xspi_PollStatus[Instance];
+#else
+  return XSPI_PollingMemReady(Instance, Timeout);
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+}
+
+/**
+  * @brief  Read the status register until the WIP(Write In Progress) bit is 0
+  * @param  Instance  XSPI instance
+  * @param  Timeout   Timeout duration in ms
+  * @retval BSP status
+  */
+static int32_t XSPI_PollingMemReady(uint32_t Instance, uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+  uint8_t reg;
+
+  reg = 0xFFU;
+
+  while ((reg & MX25R3235F_SR_WIP) != 0U)
+  {
+    if (MX25R3235F_ReadStatusRegister(&hxspi[Instance], &reg) != MX25R3235F_OK)
+    {
+      return BSP_ERROR_COMPONENT_FAILURE;
+    }
+#if (USE_BSP_XSPI_STATS == 1)
+    Xspi_Stats[Instance].Stats.Polls++;
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+
+    if (((reg & MX25R3235F_SR_WIP) != 0U) && ((HAL_GetTick() - tickstart) > Timeout))
+    {
+#if (USE_BSP_XSPI_STATS == 1)
+      Xspi_Stats[Instance].Stats.PollTimeouts++;
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+      return BSP_ERROR_COMPONENT_FAILURE;
+    }
+  }
+
+#if (USE_BSP_XSPI_STATS == 1)
+  XSPI_StatsEraseEnd(Instance, BSP_ERROR_NONE);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Reads an amount of data from the XSPI memory: from the memory-mapped window
+  *         when it is enabled, else in indirect mode after programming the pending write
+  *         combining data of the area, through the read cache for small reads.
+  * @param  Instance  XSPI instance
+  * @param  pData     Pointer to data to be read
+  * @param  ReadAddr  Read start address
+  * @param  Size      Size of data to read
+  * @retval BSP status
+  */
+static int32_t XSPI_ReadMemory(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
+{
+  int32_t ret;
+
+  /* Check the area */
+  if ((ReadAddr >= MX25R3235F_FLASH_SIZE) || (Size > (MX25R3235F_FLASH_SIZE - ReadAddr)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+  /* Copy from the memory-mapped window, no data is left pending in write combining while mapped.
+     While it is left for an erase or a program, the XSPI is in indirect mode */
+  else if ((Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP) && (Xspi_MmpLeft[Instance] == 0U))
+  {
+    (void)memcpy(pData, (const uint8_t *)(XSPI1_BASE + ReadAddr), Size);
+    ret = BSP_ERROR_NONE;
+  }
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+  /* Program the pending page first if it is read */
+  else if (XSPI_WriteCombineFlush(Instance, ReadAddr, Size) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+  /* Large reads bypass the cache so that they do not evict all the lines */
+  else if (Size <= (BSP_XSPI_CACHE_LINE_SIZE * BSP_XSPI_CACHE_LINES_NBR))
+  {
+    ret = XSPI_CacheRead(Instance, pData, ReadAddr, Size);
+  }
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+  else
+  {
+    ret = XSPI_ReadData(Instance, pData, ReadAddr, Size);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Writes an amount of data to the XSPI memory in indirect mode, through the
+  *         write combining page image when it is enabled.
+  * @param  Instance  XSPI instance
+  * @param  pData     Pointer to data to be written
+  * @param  WriteAddr Write start address
+  * @param  Size      Size of data to write
+  * @retval BSP status
+  */
+static int32_t XSPI_WriteData(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
+{
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+  return XSPI_WriteCombine(Instance, pData, WriteAddr, Size);
+#else
+  return XSPI_Write(Instance, pData, WriteAddr, Size);
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+}
+
+#if (USE_BSP_XSPI_VECTOR_IO == 1)
+/**
+  * @brief  Returns the total size of a list of buffers.
+  * @param  pVec   Pointer to the buffer descriptors
+  * @param  NbVec  Number of buffer descriptors
+  * @retval Total size in bytes
+  */
+static uint32_t XSPI_VectorSize(const BSP_XSPI_IoVec_t *pVec, uint32_t NbVec)
+{
+  uint32_t size = 0U;
+  uint32_t index;
+
+  for (index = 0U; index < NbVec; index++)
+  {
+    size += pVec[index].Size;
+  }
+
+  return size;
+}
+
+/**
+  * @brief  Reads an amount of data from the XSPI memory into a list of buffers.
+  * @param  Instance  XSPI instance
+  * @param  pVec      Pointer to the buffer descriptors
+  * @param  NbVec     Number of buffer descriptors
+  * @param  ReadAddr  Read start address
+  * @retval BSP status
+  */
+static int32_t XSPI_ReadVector(uint32_t Instance, const BSP_XSPI_IoVec_t *pVec, uint32_t NbVec, uint32_t ReadAddr)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t index;
+  uint32_t address = ReadAddr;
+
+  for (index = 0U; (index < NbVec) && (ret == BSP_ERROR_NONE); index++)
+  {
+    /* Empty descriptors are skipped */
+    if (pVec[index].Size != 0U)
+    {
+      ret = XSPI_ReadMemory(Instance, pVec[index].pData, address, pVec[index].Size);
+      address += pVec[index].Size;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Writes the data of a list of buffers to the XSPI memory in indirect mode.
+  *         Without write combining, each page is programmed once with the parts of all
+  *         the buffers falling in it, the data being sent from the buffers themselves.
+  * @param  Instance  XSPI instance
+  * @param  pVec      Pointer to the buffer descriptors
+  * @param  NbVec     Number of buffer descriptors
+  * @param  WriteAddr Write start address
+  * @retval BSP status
+  */
+static int32_t XSPI_WriteVector(uint32_t Instance, const BSP_XSPI_IoVec_t *pVec, uint32_t NbVec, uint32_t WriteAddr)
+{
+  int32_t ret = BSP_ERROR_NONE;
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+  uint32_t index;
+  uint32_t address = WriteAddr;
+
+  /* The write combining page image gathers the buffers sharing a page */
+  for (index = 0U; (index < NbVec) && (ret == BSP_ERROR_NONE); index++)
+  {
+    /* Empty descriptors are skipped */
+    if (pVec[index].Size != 0U)
+    {
+      ret = XSPI_WriteData(Instance, pVec[index].pData, address, pVec[index].Size);
+      address += pVec[index].Size;
+    }
+  }
+#else
+  uint32_t index = 0U;
+  uint32_t offset = 0U;
+  uint32_t end_addr = WriteAddr + XSPI_VectorSize(pVec, NbVec);
+  uint32_t page_addr = WriteAddr;
+  uint32_t page_size = 0U;
+  uint32_t address;
+  uint32_t size;
+  uint32_t length;
+  const uint8_t *data;
+#if (USE_BSP_XSPI_WRITE_VERIFY == 1)
+  uint32_t match;
+#endif /* (USE_BSP_XSPI_WRITE_VERIFY == 1) */
+
+  /* Perform the write page by page */
+  while ((page_addr < end_addr) && (ret == BSP_ERROR_NONE))
+  {
+    page_size = MX25R3235F_PAGE_SIZE - (page_addr % MX25R3235F_PAGE_SIZE);
+    if (page_size > (end_addr - page_addr))
+    {
+      page_size = end_addr - page_addr;
+    }
+
+    /* One page program for the parts of all the buffers falling in the page */
+    if (XSPI_ProgramPageVector(Instance, pVec, index, offset, page_addr, page_size) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }/* Configure automatic polling mode to wait for end of program */
+    else if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      /* Move to the next page part by part */
+      address = page_addr;
+      size    = page_size;
+      while ((size != 0U) && (ret == BSP_ERROR_NONE))
+      {
+        length = XSPI_VectorSegment(pVec, &index, &offset, size, &data);
+#if (USE_BSP_XSPI_WRITE_VERIFY == 1)
+        /* Compare the programmed part with the source data */
+        if (XSPI_VerifyPage(Instance, data, address, length, &match) != BSP_ERROR_NONE)
+        {
+          ret = BSP_ERROR_COMPONENT_FAILURE;
+        }
+        else if (match == 0U)
+        {
+          ret = BSP_ERROR_XSPI_VERIFY_FAILURE;
+        }
+        else
+#endif /* (USE_BSP_XSPI_WRITE_VERIFY == 1) */
+        {
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+          /* Keep the cached lines coherent with the programmed part */
+          XSPI_CacheUpdate(Instance, data, address, length);
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+          address += length;
+          size    -= length;
+        }
+      }
+
+      if (ret == BSP_ERROR_NONE)
+      {
+        page_addr += page_size;
+      }
+    }
+  }
+
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+  /* The content of the failed page is unknown: drop its cached lines */
+  if (ret != BSP_ERROR_NONE)
+  {
+    XSPI_CacheInvalidate(Instance, page_addr, page_size);
+  }
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+
+  return ret;
+}
+
+#if (USE_BSP_XSPI_WRITE_COMBINE == 0)
+/**
+  * @brief  Returns the next contiguous part of a list of buffers and moves the position
+  *         after it. Empty descriptors are skipped, the list must hold Size more bytes.
+  * @param  pVec     Pointer to the buffer descriptors
+  * @param  pIndex   Pointer to the descriptor of the position
+  * @param  pOffset  Pointer to the offset of the position in its descriptor
+  * @param  Size     Maximum size of the part
+  * @param  ppData   Pointer to the start of the part
+  * @retval Size of the part
+  */
+static uint32_t XSPI_VectorSegment(const BSP_XSPI_IoVec_t *pVec, uint32_t *pIndex, uint32_t *pOffset, uint32_t Size,
+                                   const uint8_t **ppData)
+{
+  uint32_t length;
+
+  /* Skip the empty and the consumed descriptors */
+  while (*pOffset == pVec[*pIndex].Size)
+  {
+    *pIndex += 1U;
+    *pOffset = 0U;
+  }
+
+  length = pVec[*pIndex].Size - *pOffset;
+  if (length > Size)
+  {
+    length = Size;
+  }
+
+  *ppData   = &pVec[*pIndex].pData[*pOffset];
+  *pOffset += length;
+
+  return length;
+}
+
+/**
+  * @brief  Starts the program of a page with data taken from a list of buffers, once the
+  *         memory is ready, without waiting for the end of the program.
+  * @param  Instance  XSPI instance
+  * @param  pVec      Pointer to the buffer descriptors
+  * @param  Index     Descriptor of the first data byte
+  * @param  Offset    Offset of the first data byte in its descriptor
+  * @param  WriteAddr Write start address
+  * @param  Size      Size of data to write, not crossing a page boundary
+  * @retval BSP status
+  */
+static int32_t XSPI_ProgramPageVector(uint32_t Instance, const BSP_XSPI_IoVec_t *pVec, uint32_t Index,
+                                      uint32_t Offset, uint32_t WriteAddr, uint32_t Size)
+{
+  int32_t ret;
+  XSPI_RegularCmdTypeDef s_command = {0};
+
+  /* No other program is allowed while a program is suspended */
+  if (Xspi_ProgramSuspended[Instance] != 0U)
+  {
+    ret = BSP_ERROR_BUSY;
+  }/* Check if Flash busy ? */
+  else if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }/* Enable write operations */
+  else if (MX25R3235F_WriteEnable(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+    /* One page program command for the whole part of the page */
+    XSPI_InitProgramCommand(Instance, &s_command, WriteAddr, Size);
+
+    if (HAL_XSPI_Command(&hxspi[Instance], &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      ret = XSPI_TransmitVector(Instance, pVec, Index, Offset, Size);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Sends the data phase of the configured indirect write command from a list of
+  *         buffers. The FIFO is fed as HAL_XSPI_Transmit() does, but from the buffers one
+  *         after the other: the clock is held while the FIFO is empty, so the memory sees
+  *         a single program of the whole size.
+  * @param  Instance  XSPI instance
+  * @param  pVec      Pointer to the buffer descriptors
+  * @param  Index     Descriptor of the first data byte
+  * @param  Offset    Offset of the first data byte in its descriptor
+  * @param  Size      Size of the data phase configured in the command
+  * @retval BSP status
+  */
+static int32_t XSPI_TransmitVector(uint32_t Instance, const BSP_XSPI_IoVec_t *pVec, uint32_t Index, uint32_t Offset,
+                                   uint32_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  __IO uint8_t *data_reg = (__IO uint8_t *)&hxspi[Instance].Instance->DR;
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t index = Index;
+  uint32_t offset = Offset;
+  uint32_t size = Size;
+  uint32_t length;
+  const uint8_t *data;
+
+  /* Indirect write mode */
+  MODIFY_REG(hxspi[Instance].Instance->CR, XSPI_CR_FMODE, 0U);
+
+  while ((size != 0U) && (ret == BSP_ERROR_NONE))
+  {
+    length = XSPI_VectorSegment(pVec, &index, &offset, size, &data);
+    size  -= length;
+
+    while ((length != 0U) && (ret == BSP_ERROR_NONE))
+    {
+      if (XSPI_WaitFlag(Instance, HAL_XSPI_FLAG_FT, tickstart) != BSP_ERROR_NONE)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else
+      {
+        *data_reg = *data;
+        data++;
+        length--;
+      }
+    }
+  }
+
+  /* Wait for the end of the transfer */
+  if (ret == BSP_ERROR_NONE)
+  {
+    if (XSPI_WaitFlag(Instance, HAL_XSPI_FLAG_TC, tickstart) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      __HAL_XSPI_CLEAR_FLAG(&hxspi[Instance], HAL_XSPI_FLAG_TC);
+    }
+  }
+
+  if (ret != BSP_ERROR_NONE)
+  {
+    (void)HAL_XSPI_Abort(&hxspi[Instance]);
+  }
+
+  /* The data phase is over: the handle accepts a new command */
+  hxspi[Instance].State = HAL_XSPI_STATE_READY;
+
+  return ret;
+}
+
+/**
+  * @brief  Waits for an XSPI flag to be set.
+  * @param  Instance  XSPI instance
+  * @param  Flag      XSPI flag
+  * @param  Tickstart Tick at the start of the transfer
+  * @retval BSP status
+  */
+static int32_t XSPI_WaitFlag(uint32_t Instance, uint32_t Flag, uint32_t Tickstart)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  while ((__HAL_XSPI_GET_FLAG(&hxspi[Instance], Flag) == RESET) && (ret == BSP_ERROR_NONE))
+  {
+    if ((HAL_GetTick() - Tickstart) > HAL_XSPI_TIMEOUT_DEFAULT_VALUE)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+  }
+
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 0) */
+#endif /* (USE_BSP_XSPI_VECTOR_IO == 1) */
+
+/**
+  * @brief  Erases the specified block of the XSPI memory in indirect mode.
+  * @param  Instance     XSPI instance
+  * @param  BlockAddress Block address to erase
+  * @param  BlockSize    Erase Block size
+  * @retval BSP status
+  */
+static int32_t XSPI_EraseBlock(uint32_t Instance, uint32_t BlockAddress, BSP_XSPI_Erase_t BlockSize)
+{
+  int32_t ret;
+#if (USE_BSP_XSPI_BLANK_CHECK == 1)
+  uint32_t blank = 0U;
+#endif /* (USE_BSP_XSPI_BLANK_CHECK == 1) */
+
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+  /* Program the pending data before the erase */
+  if (XSPI_WriteCombineFlush(Instance, 0U, MX25R3235F_FLASH_SIZE) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }/* Check Flash busy ? */
+  else if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
+#else
+  /* Check Flash busy ? */
+  if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#if (USE_BSP_XSPI_BLANK_CHECK == 1)
+  /* Check if the block is already erased */
+  else if (XSPI_BlankCheck(Instance, BlockAddress & ~(XSPI_GetEraseSize(BlockSize) - 1U),
+                           XSPI_GetEraseSize(BlockSize), &blank) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if (blank != 0U)
+  {
+    Xspi_EraseStats[Instance].Skipped++;
+    ret = BSP_ERROR_NONE;
+  }
+#endif /* (USE_BSP_XSPI_BLANK_CHECK == 1) */
+  /* Enable write operations */
+  else if (MX25R3235F_WriteEnable(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }/* Issue Block Erase command */
+  else if (MX25R3235F_BlockErase(&hxspi[Instance],BlockAddress, BlockSize) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+    /* Drop the cached lines of the erased block, and keep it out of the cache until the end of the erase */
+    XSPI_CacheEraseStart(Instance, BlockAddress & ~(XSPI_GetEraseSize(BlockSize) - 1U),
+                         XSPI_GetEraseSize(BlockSize));
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+#if (USE_BSP_XSPI_STATS == 1)
+    XSPI_StatsEraseStart(Instance, XSPI_GetEraseSize(BlockSize));
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_BLANK_CHECK == 1)
+    Xspi_EraseStats[Instance].Performed++;
+#endif /* (USE_BSP_XSPI_BLANK_CHECK == 1) */
+    ret = BSP_ERROR_NONE;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Erases the entire XSPI memory in indirect mode.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static int32_t XSPI_EraseChip(uint32_t Instance)
+{
+  int32_t ret;
+
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+  /* Program the pending data before the erase */
+  if (XSPI_WriteCombineFlush(Instance, 0U, MX25R3235F_FLASH_SIZE) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }/* Check Flash busy ? */
+  else if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
+#else
+  /* Check Flash busy ? */
+  if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }/* Enable write operations */
+  else if (MX25R3235F_WriteEnable(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }/* Issue Chip erase command */
+  else if (MX25R3235F_ChipErase(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+    /* Drop all the cached lines, and keep the memory out of the cache until the end of the erase */
+    XSPI_CacheEraseStart(Instance, 0U, MX25R3235F_FLASH_SIZE);
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+#if (USE_BSP_XSPI_STATS == 1)
+    XSPI_StatsEraseStart(Instance, MX25R3235F_FLASH_SIZE);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+    ret = BSP_ERROR_NONE;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Erases an area of the XSPI memory in indirect mode and waits for the end of
+  *         the operation.
+  * @param  Instance  XSPI instance
+  * @param  Address   Start address of the area, multiple of BSP_XSPI_BLOCK_4K
+  * @param  Size      Size of the area, multiple of BSP_XSPI_BLOCK_4K
+  * @retval BSP status
+  */
+static int32_t XSPI_EraseRange(uint32_t Instance, uint32_t Address, uint32_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t current_addr;
+  uint32_t end_addr;
+  uint32_t block_size;
+  BSP_XSPI_Erase_t block_type;
+
+  current_addr = Address;
+  end_addr = Address + Size;
+
+  /* Erase block by block, each erase waits for the end of the previous one */
+  while ((current_addr < end_addr) && (ret == BSP_ERROR_NONE))
+  {
+    if (((current_addr % BSP_XSPI_BLOCK_64K) == 0U) && ((end_addr - current_addr) >= BSP_XSPI_BLOCK_64K))
+    {
+      block_type = BSP_XSPI_ERASE_64K;
+      block_size = BSP_XSPI_BLOCK_64K;
+    }
+    else if (((current_addr % BSP_XSPI_BLOCK_32K) == 0U) && ((end_addr - current_addr) >= BSP_XSPI_BLOCK_32K))
+    {
+      block_type = BSP_XSPI_ERASE_32K;
+      block_size = BSP_XSPI_BLOCK_32K;
+    }
+    else
+    {
+      block_type = BSP_XSPI_ERASE_4K;
+      block_size = BSP_XSPI_BLOCK_4K;
+    }
+
+    ret = XSPI_EraseBlock(Instance, current_addr, block_type);
+    current_addr += block_size;
+  }
+
+  /* Wait for the end of the last erase */
+  if ((ret == BSP_ERROR_NONE) &&
+      (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE))
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Reads current status of the XSPI memory in indirect mode.
+  * @param  Instance  XSPI instance
+  * @retval XSPI memory status: whether busy or not
+  */
+static int32_t XSPI_GetStatus(uint32_t Instance)
+{
+  static uint8_t reg[1];
+  int32_t ret;
+
+  if (MX25R3235F_ReadSecurityRegister(&hxspi[Instance], reg) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }/* Check the value of the register */
+  else if ((reg[0] & (MX25R3235F_SECR_P_FAIL | MX25R3235F_SECR_E_FAIL)) != 0U)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if ((reg[0] & (MX25R3235F_SECR_PSB | MX25R3235F_SECR_ESB)) != 0U)
+  {
+    ret = BSP_ERROR_XSPI_SUSPENDED;
+  }
+  else if (MX25R3235F_ReadStatusRegister(&hxspi[Instance], reg) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }/* Check the value of the register */
+  else if ((reg[0] & MX25R3235F_SR_WIP) != 0U)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+  else
+  {
+    ret = BSP_ERROR_NONE;
+  }
+
+#if (USE_BSP_XSPI_STATS == 1)
+  /* End of the measured erase, or its failure */
+  if ((ret == BSP_ERROR_NONE) || (ret == BSP_ERROR_COMPONENT_FAILURE))
+  {
+    XSPI_StatsEraseEnd(Instance, ret);
+  }
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+
+  return ret;
+}
+
+/**
+  * @brief  Writes an amount of data to the XSPI memory, page by page.
+  * @param  Instance  XSPI instance
+  * @param  pData     Pointer to data to be written
+  * @param  WriteAddr Write start address
+  * @param  Size      Size of data to write
+  * @retval BSP status
+  */
+static int32_t XSPI_Write(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t end_addr;
+  uint32_t current_size;
+  uint32_t current_addr;
+  const uint8_t *data_addr;
+#if (USE_BSP_XSPI_WRITE_VERIFY == 1)
+  uint32_t match;
+#endif /* (USE_BSP_XSPI_WRITE_VERIFY == 1) */
+
+  /* Calculation of the size between the write address and the end of the page */
+  current_size = MX25R3235F_PAGE_SIZE - (WriteAddr % MX25R3235F_PAGE_SIZE);
+
+  /* Check if the size of the data is less than the remaining place in the page */
+  if (current_size > Size)
+  {
+    current_size = Size;
+  }
+
+  /* Initialize the address variables */
+  current_addr = WriteAddr;
+  end_addr = WriteAddr + Size;
+  data_addr = pData;
+
+  /* Perform the write page by page */
+  do
+  {
+    /* Issue page program command */
+    if (XSPI_ProgramPage(Instance, data_addr, current_addr, current_size) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }/* Configure automatic polling mode to wait for end of program */
+    else if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+#if (USE_BSP_XSPI_WRITE_VERIFY == 1)
+    /* Compare the programmed page with the source data */
+    else if (XSPI_VerifyPage(Instance, data_addr, current_addr, current_size, &match) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else if (match == 0U)
+    {
+      ret = BSP_ERROR_XSPI_VERIFY_FAILURE;
+    }
+#endif /* (USE_BSP_XSPI_WRITE_VERIFY == 1) */
+    else
+    {
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+      /* Keep the cached lines coherent with the programmed page */
+      XSPI_CacheUpdate(Instance, data_addr, current_addr, current_size);
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+
+      /* Update the address and size variables for next page programming */
+      current_addr += current_size;
+      data_addr += current_size;
+      current_size = ((current_addr + MX25R3235F_PAGE_SIZE) > end_addr)
+                     ? (end_addr - current_addr)
+                     : MX25R3235F_PAGE_SIZE;
+    }
+  } while ((current_addr < end_addr) && (ret == BSP_ERROR_NONE));
+
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+  /* The content of the failed page is unknown: drop its cached lines */
+  if (ret != BSP_ERROR_NONE)
+  {
+    XSPI_CacheInvalidate(Instance, current_addr, current_size);
+  }
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Starts the program of a page once the memory is ready, without waiting
+  *         for the end of the program.
+  * @param  Instance  XSPI instance
+  * @param  pData     Pointer to data to be written
+  * @param  WriteAddr Write start address
+  * @param  Size      Size of data to write, not crossing a page boundary
+  * @retval BSP status
+  */
+static int32_t XSPI_ProgramPage(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  XSPI_RegularCmdTypeDef s_command = {0};
+
+  /* No other program is allowed while a program is suspended */
+  if (Xspi_ProgramSuspended[Instance] != 0U)
+  {
+    ret = BSP_ERROR_BUSY;
+  }/* Check if Flash busy ? */
+  else if (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }/* Enable write operations */
+  else if (MX25R3235F_WriteEnable(&hxspi[Instance]) != MX25R3235F_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }/* Issue page program command */
+  else if (Xspi_Ctx[Instance].ProgramCommand == BSP_XSPI_PROGRAM_DEFAULT)
+  {
+    if (MX25R3235F_PageProgram(&hxspi[Instance], Xspi_Ctx[Instance].InterfaceMode, (uint8_t *)pData, WriteAddr,
+                               Size) != MX25R3235F_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+  }
+  else
+  {
+    /* Explicit program command: PP on one line or 4PP on four lines */
+    XSPI_InitProgramCommand(Instance, &s_command, WriteAddr, Size);
+
+    if (HAL_XSPI_Command(&hxspi[Instance], &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else if (HAL_XSPI_Transmit(&hxspi[Instance], (uint8_t *)pData, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      /* Page program started */
+    }
+  }
+
+  return ret;
+}
+
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+/**
+  * @brief  Writes an amount of data through the write combining page image.
+  *         Data is merged in the image with the AND semantic of the page program, and
+  *         whole pages written while no data is pending are programmed directly.
+  * @param  Instance  XSPI instance
+  * @param  pData     Pointer to data to be written
+  * @param  WriteAddr Write start address
+  * @param  Size      Size of data to write
+  * @retval BSP status
+  */
+static int32_t XSPI_WriteCombine(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  XSPI_WriteCombine_t *wc = &Xspi_WriteCombine[Instance];
+  uint8_t *page = (uint8_t *)wc->Data;
+  uint32_t current_addr = WriteAddr;
+  uint32_t end_addr = WriteAddr + Size;
+  uint32_t page_addr;
+  uint32_t offset;
+  uint32_t length;
+  uint32_t index;
+
+  while ((current_addr < end_addr) && (ret == BSP_ERROR_NONE))
+  {
+    offset    = current_addr % MX25R3235F_PAGE_SIZE;
+    page_addr = current_addr - offset;
+    length    = MX25R3235F_PAGE_SIZE - offset;
+    if (length > (end_addr - current_addr))
+    {
+      length = end_addr - current_addr;
+    }
+
+    /* A write to another page programs the pending one */
+    if ((wc->Pending != 0U) && (wc->Address != page_addr))
+    {
+      ret = XSPI_WriteCombineFlush(Instance, 0U, MX25R3235F_FLASH_SIZE);
+    }
+
+    if (ret == BSP_ERROR_NONE)
+    {
+      if ((wc->Pending == 0U) && (length == MX25R3235F_PAGE_SIZE))
+      {
+        ret = XSPI_Write(Instance, pData, current_addr, length);
+      }
+      else
+      {
+        if (wc->Pending == 0U)
+        {
+          (void)memset(wc->Data, 0xFF, MX25R3235F_PAGE_SIZE);
+          wc->Address = page_addr;
+          wc->Start   = offset;
+          wc->End     = offset + length;
+          wc->Tick    = HAL_GetTick();
+          wc->Pending = 1U;
+        }
+        else
+        {
+          wc->Start = (offset < wc->Start) ? offset : wc->Start;
+          wc->End   = ((offset + length) > wc->End) ? (offset + length) : wc->End;
+        }
+
+        for (index = 0U; index < length; index++)
+        {
+          page[offset + index] &= pData[index];
+        }
+
+        /* Appending up to the end of the page completes it */
+        if ((offset + length) == MX25R3235F_PAGE_SIZE)
+        {
+          ret = XSPI_WriteCombineFlush(Instance, 0U, MX25R3235F_FLASH_SIZE);
+        }
+      }
+
+      pData        += length;
+      current_addr += length;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Programs the write combining page image if it overlaps a memory area.
+  *         The pending data is dropped even if the program fails.
+  * @param  Instance  XSPI instance
+  * @param  Address   Start address of the area
+  * @param  Size      Size of the area
+  * @retval BSP status
+  */
+static int32_t XSPI_WriteCombineFlush(uint32_t Instance, uint32_t Address, uint32_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  XSPI_WriteCombine_t *wc = &Xspi_WriteCombine[Instance];
+#if (USE_BSP_XSPI_STATS == 1)
+  uint32_t start_cycles;
+  uint32_t start_polls;
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+
+  if ((wc->Pending != 0U) && (Address < (wc->Address + MX25R3235F_PAGE_SIZE)) &&
+      (wc->Address < (Address + Size)))
+  {
+    /* The pending data is kept until the suspended program is resumed */
+    if (Xspi_ProgramSuspended[Instance] != 0U)
+    {
+      ret = BSP_ERROR_BUSY;
+    }
+    else
+    {
+      wc->Pending = 0U;
+
+#if (USE_BSP_XSPI_STATS == 1)
+      /* The page program is accounted in its own operation, whichever function needs it */
+      CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+      DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+      start_cycles = DWT->CYCCNT;
+      start_polls  = Xspi_Stats[Instance].Stats.Polls;
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+
+      /* Only the range holding pending data is programmed */
+      ret = XSPI_Write(Instance, &((const uint8_t *)wc->Data)[wc->Start], wc->Address + wc->Start,
+                       wc->End - wc->Start);
+
+#if (USE_BSP_XSPI_STATS == 1)
+      XSPI_StatsAccount(Instance, BSP_XSPI_STATS_FLUSH, wc->End - wc->Start, ret, DWT->CYCCNT - start_cycles,
+                        Xspi_Stats[Instance].Stats.Polls - start_polls);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+    }
+  }
+
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+
+#if (USE_BSP_XSPI_SCHEDULER == 1)
+/**
+  * @brief  Looks for the oldest of the queued requests with the highest priority.
+  * @param  pScheduler   Scheduler context
+  * @param  ReadOnly     If not 0, only read requests are considered
+  * @retval Queue index of the request, pScheduler->Count if none
+  */
+static uint32_t XSPI_SchedulerFind(const XSPI_Scheduler_t *pScheduler, uint32_t ReadOnly)
+{
+  uint32_t selected = pScheduler->Count;
+  uint32_t index;
+
+  for (index = 0U; index < pScheduler->Count; index++)
+  {
+    if (((ReadOnly == 0U) || (pScheduler->Queue[index]->Type == BSP_XSPI_REQUEST_READ)) &&
+        ((selected == pScheduler->Count) ||
+         (pScheduler->Queue[index]->Priority > pScheduler->Queue[selected]->Priority)))
+    {
+      selected = index;
+    }
+  }
+
+  return selected;
+}
+
+/**
+  * @brief  Removes from the queue the oldest of the requests with the highest priority.
+  * @param  pScheduler   Scheduler context
+  * @param  ReadOnly     If not 0, only read requests are considered
+  * @retval Pointer to the request, NULL if none
+  */
+static BSP_XSPI_Request_t *XSPI_SchedulerPop(XSPI_Scheduler_t *pScheduler, uint32_t ReadOnly)
+{
+  BSP_XSPI_Request_t *request = NULL;
+  uint32_t primask;
+  uint32_t index;
+
+  /* The queue is also updated by BSP_XSPI_Submit() from interrupt handlers */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  index = XSPI_SchedulerFind(pScheduler, ReadOnly);
+  if (index < pScheduler->Count)
+  {
+    request = pScheduler->Queue[index];
+
+    /* Keep the submission order of the other requests */
+    for (; index < (pScheduler->Count - 1U); index++)
+    {
+      pScheduler->Queue[index] = pScheduler->Queue[index + 1U];
+    }
+    pScheduler->Count--;
+  }
+
+  __set_PRIMASK(primask);
+
+  return request;
+}
+
+/**
+  * @brief  Runs one step of the XSPI scheduler.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static int32_t XSPI_SchedulerProcess(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  int32_t status;
+  XSPI_Scheduler_t *scheduler = &Xspi_Scheduler[Instance];
+  BSP_XSPI_Request_t *request;
+
+  if (scheduler->pBusy != NULL)
+  {
+    status = BSP_XSPI_GetStatus(Instance);
+    if (status == BSP_ERROR_BUSY)
+    {
+      /* Only suspend the on-going operation for pending reads */
+      if (XSPI_SchedulerFind(scheduler, 1U) < scheduler->Count)
+      {
+        ret = XSPI_SchedulerPreempt(Instance);
+      }
+    }
+    else if (status == BSP_ERROR_XSPI_SUSPENDED)
+    {
+      /* Suspended by the application: wait for its resume */
+    }
+    else
+    {
+      XSPI_SchedulerBusyDone(Instance, status);
+    }
+  }
+  else
+  {
+    /* Reads are served between the pages of a program in progress */
+    request = XSPI_SchedulerPop(scheduler, (scheduler->pProgram != NULL) ? 1U : 0U);
+
+    if (request != NULL)
+    {
+      XSPI_SchedulerStart(Instance, request);
+    }
+    else if (scheduler->pProgram != NULL)
+    {
+      XSPI_SchedulerProgramPage(Instance);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Suspends the on-going erase or page program to serve the pending reads,
+  *         then resumes it.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static int32_t XSPI_SchedulerPreempt(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  XSPI_Scheduler_t *scheduler = &Xspi_Scheduler[Instance];
+
+  if (scheduler->pBusy->Type == BSP_XSPI_REQUEST_ERASE)
+  {
+    if ((scheduler->Suspends < BSP_XSPI_MAX_ERASE_SUSPEND) &&
+        (BSP_XSPI_SuspendErase(Instance) == BSP_ERROR_NONE))
+    {
+      scheduler->Suspends++;
+      XSPI_SchedulerServeReads(Instance);
+      ret = BSP_XSPI_ResumeErase(Instance);
+    }
+  }
+  else
+  {
+    if ((scheduler->Suspends < BSP_XSPI_MAX_PROGRAM_SUSPEND) &&
+        (BSP_XSPI_SuspendProgram(Instance) == BSP_ERROR_NONE))
+    {
+      scheduler->Suspends++;
+      XSPI_SchedulerServeReads(Instance);
+      ret = BSP_XSPI_ResumeProgram(Instance);
+    }
+  }
+
+  /* An operation left suspended would never end: fail its request */
+  if (ret != BSP_ERROR_NONE)
+  {
+    XSPI_SchedulerBusyDone(Instance, ret);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Ends the on-going erase or page program.
+  * @param  Instance  XSPI instance
+  * @param  Status    BSP status of the operation
+  * @retval None
+  */
+static void XSPI_SchedulerBusyDone(uint32_t Instance, int32_t Status)
+{
+  XSPI_Scheduler_t *scheduler = &Xspi_Scheduler[Instance];
+  BSP_XSPI_Request_t *request = scheduler->pBusy;
+
+  scheduler->pBusy = NULL;
+  if (request->Type == BSP_XSPI_REQUEST_PROGRAM)
+  {
+    /* End of the page program */
+    XSPI_SchedulerPageDone(Instance, Status);
+  }
+  else
+  {
+    /* End of the erase */
+    BSP_XSPI_RequestCpltCallback(Instance, request, Status);
+  }
+}
+
+/**
+  * @brief  Serves all the pending read requests while the on-going operation is suspended.
+  * @param  Instance  XSPI instance
+  * @retval None
+  */
+static void XSPI_SchedulerServeReads(uint32_t Instance)
+{
+  BSP_XSPI_Request_t *request;
+
+  request = XSPI_SchedulerPop(&Xspi_Scheduler[Instance], 1U);
+  while (request != NULL)
+  {
+    XSPI_SchedulerStart(Instance, request);
+    request = XSPI_SchedulerPop(&Xspi_Scheduler[Instance], 1U);
+  }
+}
+
+/**
+  * @brief  Starts a request: reads are done at once, erases are issued and programs
+  *         are then written page by page by the next scheduler steps.
+  * @param  Instance  XSPI instance
+  * @param  pRequest  Pointer to the request
+  * @retval None
+  */
+static void XSPI_SchedulerStart(uint32_t Instance, BSP_XSPI_Request_t *pRequest)
+{
+  int32_t status;
+  XSPI_Scheduler_t *scheduler = &Xspi_Scheduler[Instance];
+
+  switch (pRequest->Type)
+  {
+    case BSP_XSPI_REQUEST_READ :
+      status = BSP_XSPI_Read(Instance, pRequest->pData, pRequest->Address, pRequest->Size);
+      BSP_XSPI_RequestCpltCallback(Instance, pRequest, status);
+      break;
+
+    case BSP_XSPI_REQUEST_ERASE :
+      status = BSP_XSPI_Erase_Block(Instance, pRequest->Address, pRequest->BlockSize);
+      if (status == BSP_ERROR_NONE)
+      {
+        /* The end of the erase is checked by the next scheduler steps */
+        scheduler->pBusy    = pRequest;
+        scheduler->Suspends = 0U;
+      }
+      else
+      {
+        BSP_XSPI_RequestCpltCallback(Instance, pRequest, status);
+      }
+      break;
+
+    case BSP_XSPI_REQUEST_PROGRAM :
+      scheduler->pProgram = pRequest;
+      scheduler->Offset   = 0U;
+      XSPI_SchedulerProgramPage(Instance);
+      break;
+
+    default :
+      BSP_XSPI_RequestCpltCallback(Instance, pRequest, BSP_ERROR_WRONG_PARAM);
+      break;
+  }
+}
+
+/**
+  * @brief  Starts the program of the next page of the program request in progress.
+  *         The end of the page program is checked by the next scheduler steps.
+  * @param  Instance  XSPI instance
+  * @retval None
+  */
+static void XSPI_SchedulerProgramPage(uint32_t Instance)
+{
+  int32_t status = BSP_ERROR_NONE;
+  XSPI_Scheduler_t *scheduler = &Xspi_Scheduler[Instance];
+  BSP_XSPI_Request_t *request = scheduler->pProgram;
+  uint32_t address = request->Address + scheduler->Offset;
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+  uint32_t mmp = 0U;
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+
+  scheduler->PageSize = MX25R3235F_PAGE_SIZE - (address % MX25R3235F_PAGE_SIZE);
+  if (scheduler->PageSize > (request->Size - scheduler->Offset))
+  {
+    scheduler->PageSize = request->Size - scheduler->Offset;
+  }
+
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+  /* No program is allowed while this one is suspended: program the pending data first */
+  if (XSPI_WriteCombineFlush(Instance, 0U, MX25R3235F_FLASH_SIZE) != BSP_ERROR_NONE)
+  {
+    status = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+  /* Program in indirect mode: the memory-mapped mode is entered again once the scheduler is idle */
+  if ((status == BSP_ERROR_NONE) && (Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP))
+  {
+    mmp = 1U;
+    status = XSPI_MmpLeave(Instance);
+  }
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+
+  if ((status == BSP_ERROR_NONE) &&
+      (XSPI_ProgramPage(Instance, &request->pData[scheduler->Offset], address, scheduler->PageSize) != BSP_ERROR_NONE))
+  {
+    status = BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+  if ((mmp != 0U) && (Xspi_Ctx[Instance].IsInitialized != XSPI_ACCESS_MMP))
+  {
+    status = XSPI_MmpReenter(Instance, status);
+  }
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+
+  if (status == BSP_ERROR_NONE)
+  {
+    scheduler->pBusy    = request;
+    scheduler->Suspends = 0U;
+  }
+  else
+  {
+    XSPI_SchedulerPageDone(Instance, status);
+  }
+}
+
+/**
+  * @brief  Ends the page program of the program request in progress.
+  * @param  Instance  XSPI instance
+  * @param  Status    BSP status of the page program
+  * @retval None
+  */
+static void XSPI_SchedulerPageDone(uint32_t Instance, int32_t Status)
+{
+  XSPI_Scheduler_t *scheduler = &Xspi_Scheduler[Instance];
+  BSP_XSPI_Request_t *request = scheduler->pProgram;
+
+  if (Status == BSP_ERROR_NONE)
+  {
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+    /* Keep the cached lines coherent with the programmed page */
+    XSPI_CacheUpdate(Instance, &request->pData[scheduler->Offset], request->Address + scheduler->Offset,
+                     scheduler->PageSize);
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+    scheduler->Offset += scheduler->PageSize;
+  }
+
+  if ((Status != BSP_ERROR_NONE) || (scheduler->Offset >= request->Size))
+  {
+    scheduler->pProgram = NULL;
+    BSP_XSPI_RequestCpltCallback(Instance, request, Status);
+  }
+}
+#endif /* (USE_BSP_XSPI_SCHEDULER == 1) */
+
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+/**
+  * @brief  Read an amount of data through the XSPI read cache.
+  *         Missing lines are filled from the memory, replacing the least recently used one.
+  * @param  Instance  XSPI instance
+  * @param  pData     Pointer to data to be read
+  * @param  ReadAddr  Read start address
+  * @param  Size      Size of data to read
+  * @retval BSP status
+  */
+static int32_t XSPI_CacheRead(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  XSPI_CacheLine_t *lines = Xspi_CacheLines[Instance];
+  uint32_t current_addr = ReadAddr;
+  uint32_t end_addr = ReadAddr + Size;
+  uint32_t line_addr;
+  uint32_t offset;
+  uint32_t length;
+  uint32_t line;
+  uint32_t victim;
+
+  while ((current_addr < end_addr) && (ret == BSP_ERROR_NONE))
+  {
+    offset    = current_addr % BSP_XSPI_CACHE_LINE_SIZE;
+    line_addr = current_addr - offset;
+    length    = BSP_XSPI_CACHE_LINE_SIZE - offset;
+    if (length > (end_addr - current_addr))
+    {
+      length = end_addr - current_addr;
+    }
+
+    /* Look for the line in the cache, and for the replacement candidate */
+    victim = 0U;
+    for (line = 0U; line < BSP_XSPI_CACHE_LINES_NBR; line++)
+    {
+      if ((lines[line].Valid != 0U) && (lines[line].Address == line_addr))
+      {
+        break;
+      }
+      if ((lines[victim].Valid != 0U) &&
+          ((lines[line].Valid == 0U) || (lines[line].Age < lines[victim].Age)))
+      {
+        victim = line;
+      }
+    }
+
+    if (line < BSP_XSPI_CACHE_LINES_NBR)
+    {
+      Xspi_CacheStats[Instance].Hits++;
+    }
+    else if (XSPI_CacheErasing(Instance, line_addr) != 0U)
+    {
+      /* Partially erased data: read directly, not kept in a line */
+      Xspi_CacheStats[Instance].Misses++;
+      ret = XSPI_ReadData(Instance, pData, current_addr, length);
+    }
+    else
+    {
+      /* Fill the least recently used line */
+      Xspi_CacheStats[Instance].Misses++;
+      if (lines[victim].Valid != 0U)
+      {
+        Xspi_CacheStats[Instance].Evictions++;
+      }
+      line = victim;
+      lines[line].Valid = 0U;
+
+      ret = XSPI_ReadData(Instance, (uint8_t *)Xspi_CacheData[Instance][line], line_addr, BSP_XSPI_CACHE_LINE_SIZE);
+      if (ret == BSP_ERROR_NONE)
+      {
+        lines[line].Address = line_addr;
+        lines[line].Valid   = 1U;
+      }
+    }
+
+    if (ret == BSP_ERROR_NONE)
+    {
+      if (line < BSP_XSPI_CACHE_LINES_NBR)
+      {
+        Xspi_CacheClock[Instance]++;
+        lines[line].Age = Xspi_CacheClock[Instance];
+
+        (void)memcpy(pData, &((uint8_t *)Xspi_CacheData[Instance][line])[offset], length);
+      }
+      pData        += length;
+      current_addr += length;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Update the cached lines with programmed data.
+  *         Programming can only clear bits, so the cached bytes are ANDed with the data.
+  * @param  Instance  XSPI instance
+  * @param  pData     Pointer to programmed data
+  * @param  Address   Programmed memory address
+  * @param  Size      Number of programmed bytes
+  * @retval None
+  */
+static void XSPI_CacheUpdate(uint32_t Instance, const uint8_t *pData, uint32_t Address, uint32_t Size)
+{
+  XSPI_CacheLine_t *lines = Xspi_CacheLines[Instance];
+  uint8_t *line_data;
+  uint32_t line;
+  uint32_t index;
+
+  for (line = 0U; line < BSP_XSPI_CACHE_LINES_NBR; line++)
+  {
+    if ((lines[line].Valid != 0U) && (Address < (lines[line].Address + BSP_XSPI_CACHE_LINE_SIZE)) &&
+        (lines[line].Address < (Address + Size)))
+    {
+      line_data = (uint8_t *)Xspi_CacheData[Instance][line];
+      for (index = 0U; index < Size; index++)
+      {
+        if (((Address + index) >= lines[line].Address) &&
+            ((Address + index) < (lines[line].Address + BSP_XSPI_CACHE_LINE_SIZE)))
+        {
+          line_data[Address + index - lines[line].Address] &= pData[index];
+        }
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Invalidate the cached lines overlapping a memory area.
+  * @param  Instance  XSPI instance
+  * @param  Address   Start address of the area
+  * @param  Size      Size of the area
+  * @retval None
+  */
+static void XSPI_CacheInvalidate(uint32_t Instance, uint32_t Address, uint32_t Size)
+{
+  XSPI_CacheLine_t *lines = Xspi_CacheLines[Instance];
+  uint32_t line;
+
+  for (line = 0U; line < BSP_XSPI_CACHE_LINES_NBR; line++)
+  {
+    if ((Address < (lines[line].Address + BSP_XSPI_CACHE_LINE_SIZE)) &&
+        (lines[line].Address < (Address + Size)))
+    {
+      lines[line].Valid = 0U;
+    }
+  }
+}
+
+/**
+  * @brief  Invalidate the cached lines of an area being erased, and record the area
+  *         so that it is not cached again before the end of the erase.
+  * @param  Instance  XSPI instance
+  * @param  Address   Start address of the erased area
+  * @param  Size      Size of the erased area
+  * @retval None
+  */
+static void XSPI_CacheEraseStart(uint32_t Instance, uint32_t Address, uint32_t Size)
+{
+  XSPI_CacheErase_t *erase = &Xspi_CacheErase[Instance];
+
+  XSPI_CacheInvalidate(Instance, Address, Size);
+
+  /* Erases issued before the end of the previous ones extend the area */
+  if (erase->Pending == 0U)
+  {
+    erase->Start   = Address;
+    erase->End     = Address + Size;
+    erase->Pending = 1U;
+  }
+  else
+  {
+    erase->Start = (Address < erase->Start) ? Address : erase->Start;
+    erase->End   = ((Address + Size) > erase->End) ? (Address + Size) : erase->End;
+  }
+}
+
+/**
+  * @brief  Check if a cache line is in an area whose erase is on-going or suspended.
+  *         The memory status is only read for a line of the erased area. Once the end
+  *         of the erase is seen, the area is invalidated again and cached normally.
+  * @param  Instance  XSPI instance
+  * @param  LineAddr  Memory address of the line
+  * @retval 1 if the line must not be filled, else 0
+  */
+static uint32_t XSPI_CacheErasing(uint32_t Instance, uint32_t LineAddr)
+{
+  XSPI_CacheErase_t *erase = &Xspi_CacheErase[Instance];
+  uint32_t erasing = 0U;
+  uint8_t reg[1];
+
+  if ((erase->Pending != 0U) && (LineAddr < erase->End) &&
+      (erase->Start < (LineAddr + BSP_XSPI_CACHE_LINE_SIZE)))
+  {
+    /* A failed status read counts as an on-going erase */
+    if ((MX25R3235F_ReadStatusRegister(&hxspi[Instance], reg) != MX25R3235F_OK) ||
+        ((reg[0] & MX25R3235F_SR_WIP) != 0U))
+    {
+      erasing = 1U;
+    }
+    else if ((MX25R3235F_ReadSecurityRegister(&hxspi[Instance], reg) != MX25R3235F_OK) ||
+             ((reg[0] & MX25R3235F_SECR_ESB) != 0U))
+    {
+      erasing = 1U;
+    }
+    else
+    {
+      XSPI_CacheInvalidate(Instance, erase->Start, erase->End - erase->Start);
+      erase->Pending = 0U;
+    }
+  }
+
+  return erasing;
+}
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+
+#if (USE_BSP_XSPI_BLANK_CHECK == 1)
+/**
+  * @brief  Check if a memory area is erased. The area is read by chunks with bulk
+  *         indirect reads and compared word by word, the first programmed word ends the check.
+  * @param  Instance  XSPI instance
+  * @param  Address   Start address of the area
+  * @param  Size      Size of the area, multiple of BSP_XSPI_BLANK_CHECK_CHUNK
+  * @param  pBlank    Set to 1 if all the bytes of the area are 0xFF, else 0
+  * @retval BSP status
+  */
+static int32_t XSPI_BlankCheck(uint32_t Instance, uint32_t Address, uint32_t Size, uint32_t *pBlank)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t chunk[BSP_XSPI_BLANK_CHECK_CHUNK / 4U];
+  uint32_t current_addr = Address;
+  uint32_t index;
+
+  *pBlank = 1U;
+
+  while ((current_addr < (Address + Size)) && (*pBlank != 0U) && (ret == BSP_ERROR_NONE))
+  {
+    ret = XSPI_ReadData(Instance, (uint8_t *)chunk, current_addr, BSP_XSPI_BLANK_CHECK_CHUNK);
+    if (ret == BSP_ERROR_NONE)
+    {
+      for (index = 0U; index < (BSP_XSPI_BLANK_CHECK_CHUNK / 4U); index++)
+      {
+        if (chunk[index] != 0xFFFFFFFFUL)
+        {
+          *pBlank = 0U;
+          break;
+        }
+      }
+      current_addr += BSP_XSPI_BLANK_CHECK_CHUNK;
+    }
+  }
+
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_BLANK_CHECK == 1) */
+
+#if (USE_BSP_XSPI_WRITE_VERIFY == 1)
+/**
+  * @brief  Compare a programmed area with its source data. The area is read by chunks of
+  *         BSP_XSPI_VERIFY_CHUNK bytes with indirect reads, the first mismatch ends the check.
+  * @param  Instance  XSPI instance
+  * @param  pData     Pointer to the source data
+  * @param  Address   Start address of the programmed area
+  * @param  Size      Size of the programmed area
+  * @param  pMatch    Set to 1 if the area matches the source data, else 0
+  * @retval BSP status
+  */
+static int32_t XSPI_VerifyPage(uint32_t Instance, const uint8_t *pData, uint32_t Address, uint32_t Size,
+                               uint32_t *pMatch)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint8_t chunk[BSP_XSPI_VERIFY_CHUNK];
+  uint32_t offset = 0U;
+  uint32_t chunk_size;
+  uint32_t index;
+
+  *pMatch = 1U;
+
+  while ((offset < Size) && (*pMatch != 0U) && (ret == BSP_ERROR_NONE))
+  {
+    chunk_size = ((Size - offset) > BSP_XSPI_VERIFY_CHUNK) ? BSP_XSPI_VERIFY_CHUNK : (Size - offset);
+
+    ret = XSPI_ReadData(Instance, chunk, Address + offset, chunk_size);
+    if (ret == BSP_ERROR_NONE)
+    {
+      for (index = 0U; index < chunk_size; index++)
+      {
+        if (chunk[index] != pData[offset + index])
+        {
+          *pMatch = 0U;
+          break;
+        }
+      }
+      offset += chunk_size;
+    }
+  }
+
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_WRITE_VERIFY == 1) */
+
+#if (USE_BSP_XSPI_READ_CACHE == 1) || (USE_BSP_XSPI_BLANK_CHECK == 1) || (USE_BSP_XSPI_STATS == 1) || \
+    (USE_BSP_XSPI_TRACE == 1)
+/**
+  * @brief  Return the size in bytes of an erase block type.
+  * @param  BlockSize  Erase Block size
+  * @retval Size in bytes
+  */
+static uint32_t XSPI_GetEraseSize(BSP_XSPI_Erase_t BlockSize)
+{
+  uint32_t size;
+
+  switch (BlockSize)
+  {
+    case MX25R3235F_ERASE_4K :
+      size = MX25R3235F_SUBSECTOR_4K;
+      break;
+
+    case MX25R3235F_ERASE_32K :
+      size = MX25R3235F_BLOCK_32K;
+      break;
+
+    case MX25R3235F_ERASE_64K :
+      size = MX25R3235F_SECTOR_64K;
+      break;
+
+    default :
+      size = MX25R3235F_FLASH_SIZE;
+      break;
+  }
+
+  return size;
+}
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) || (USE_BSP_XSPI_BLANK_CHECK == 1) || (USE_BSP_XSPI_STATS == 1) ||
+          (USE_BSP_XSPI_TRACE == 1) */
+
+/**
+  * @brief  Fill a regular command structure with a single line instruction
+  *         and no address, alternate bytes, dummy cycles nor data phase.
+  * @param  pCmd         Pointer to the command structure
+  * @param  Instruction  Memory command opcode
+  * @retval None
+  */
+static void XSPI_InitCommand(XSPI_RegularCmdTypeDef *pCmd, uint32_t Instruction)
+{
+  pCmd->OperationType         = HAL_XSPI_OPTYPE_COMMON_CFG;
+  pCmd->Instruction           = Instruction;
+  pCmd->InstructionMode       = HAL_XSPI_INSTRUCTION_1_LINE;
+  pCmd->InstructionWidth      = HAL_XSPI_INSTRUCTION_8_BITS;
+  pCmd->InstructionDTRMode    = HAL_XSPI_INSTRUCTION_DTR_DISABLE;
+  pCmd->AddressMode           = HAL_XSPI_ADDRESS_NONE;
+  pCmd->AddressWidth          = HAL_XSPI_ADDRESS_24_BITS;
+  pCmd->AddressDTRMode        = HAL_XSPI_ADDRESS_DTR_DISABLE;
+  pCmd->AlternateBytesMode    = HAL_XSPI_ALT_BYTES_NONE;
+  pCmd->AlternateBytesWidth   = HAL_XSPI_ALT_BYTES_8_BITS;
+  pCmd->AlternateBytesDTRMode = HAL_XSPI_ALT_BYTES_DTR_DISABLE;
+  pCmd->DataMode              = HAL_XSPI_DATA_NONE;
+  pCmd->DataDTRMode           = HAL_XSPI_DATA_DTR_DISABLE;
+  pCmd->DummyCycles           = 0U;
+  pCmd->DQSMode               = HAL_XSPI_DQS_DISABLE;
+}
+
+/**
+  * @brief  Fill a regular command structure with the page program command of the
+  *         instance: the command selected at init, or the one matching the interface mode.
+  * @param  Instance  XSPI instance
+  * @param  pCmd      Pointer to the command structure
+  * @param  Address   Memory address of the page program
+  * @param  Size      Number of bytes to program
+  * @retval None
+  */
+static void XSPI_InitProgramCommand(uint32_t Instance, XSPI_RegularCmdTypeDef *pCmd, uint32_t Address,
+                                    uint32_t Size)
+{
+  if ((Xspi_Ctx[Instance].ProgramCommand == BSP_XSPI_PROGRAM_4PP) ||
+      ((Xspi_Ctx[Instance].ProgramCommand == BSP_XSPI_PROGRAM_DEFAULT) &&
+       (Xspi_Ctx[Instance].InterfaceMode == BSP_XSPI_QPI_MODE)))
+  {
+    XSPI_InitCommand(pCmd, XSPI_NOR_CMD_4PP);
+    pCmd->AddressMode = HAL_XSPI_ADDRESS_4_LINES;
+    pCmd->DataMode    = HAL_XSPI_DATA_4_LINES;
+  }
+  else
+  {
+    XSPI_InitCommand(pCmd, XSPI_NOR_CMD_PP);
+    pCmd->AddressMode = HAL_XSPI_ADDRESS_1_LINE;
+    pCmd->DataMode    = HAL_XSPI_DATA_1_LINE;
+  }
+
+  pCmd->Address    = Address;
+  pCmd->DataLength = Size;
+}
+
+/**
+  * @brief  Fill a regular command structure with the read command of the instance:
+  *         the command selected at init, or the one matching the interface mode.
+  * @param  Instance  XSPI instance
+  * @param  pCmd      Pointer to the command structure
+  * @param  Address   Memory address of the read
+  * @param  Size      Number of bytes to read
+  * @retval None
+  */
+static void XSPI_InitReadCommand(uint32_t Instance, XSPI_RegularCmdTypeDef *pCmd, uint32_t Address,
+                                 uint32_t Size)
+{
+  BSP_XSPI_ReadCommand_t command = Xspi_Ctx[Instance].ReadCommand;
+
+  if (command == BSP_XSPI_READ_DEFAULT)
+  {
+    command = (Xspi_Ctx[Instance].InterfaceMode == BSP_XSPI_QPI_MODE) ? BSP_XSPI_READ_4READ : BSP_XSPI_READ_FAST;
+  }
+
+  switch (command)
+  {
+    case BSP_XSPI_READ_DREAD :  /* 1-1-2 */
+      XSPI_InitCommand(pCmd, XSPI_NOR_CMD_DREAD);
+      pCmd->AddressMode = HAL_XSPI_ADDRESS_1_LINE;
+      pCmd->DataMode    = HAL_XSPI_DATA_2_LINES;
+      pCmd->DummyCycles = XSPI_NOR_DUMMY_DREAD;
+      break;
+
+    case BSP_XSPI_READ_2READ :  /* 1-2-2 */
+      XSPI_InitCommand(pCmd, XSPI_NOR_CMD_2READ);
+      pCmd->AddressMode = HAL_XSPI_ADDRESS_2_LINES;
+      pCmd->DataMode    = HAL_XSPI_DATA_2_LINES;
+      pCmd->DummyCycles = XSPI_NOR_DUMMY_2READ;
+      break;
+
+    case BSP_XSPI_READ_QREAD :  /* 1-1-4 */
+      XSPI_InitCommand(pCmd, XSPI_NOR_CMD_QREAD);
+      pCmd->AddressMode = HAL_XSPI_ADDRESS_1_LINE;
+      pCmd->DataMode    = HAL_XSPI_DATA_4_LINES;
+      pCmd->DummyCycles = XSPI_NOR_DUMMY_QREAD;
+      break;
+
+    case BSP_XSPI_READ_4READ :  /* 1-4-4, the mode bits take the 2 first dummy cycles */
+      XSPI_InitCommand(pCmd, XSPI_NOR_CMD_4READ);
+      pCmd->AddressMode        = HAL_XSPI_ADDRESS_4_LINES;
+      pCmd->AlternateBytes     = XSPI_NOR_MODE_NO_PE;
+      pCmd->AlternateBytesMode = HAL_XSPI_ALT_BYTES_4_LINES;
+      pCmd->DataMode           = HAL_XSPI_DATA_4_LINES;
+      pCmd->DummyCycles        = XSPI_NOR_DUMMY_4READ;
+      break;
+
+    case BSP_XSPI_READ_FAST :   /* 1-1-1 */
+    default :
+      XSPI_InitCommand(pCmd, XSPI_NOR_CMD_FAST_READ);
+      pCmd->AddressMode = HAL_XSPI_ADDRESS_1_LINE;
+      pCmd->DataMode    = HAL_XSPI_DATA_1_LINE;
+      pCmd->DummyCycles = XSPI_NOR_DUMMY_FAST_READ;
+      break;
+  }
+
+  /* Dummy cycles given at init count the mode bits cycles */
+  if (Xspi_Ctx[Instance].DummyCycles != 0U)
+  {
+    pCmd->DummyCycles = Xspi_Ctx[Instance].DummyCycles -
+                        ((pCmd->AlternateBytesMode != HAL_XSPI_ALT_BYTES_NONE) ? XSPI_NOR_DUMMY_MODE_BITS : 0U);
+  }
+
+  pCmd->Address    = Address;
+  pCmd->DataLength = Size;
+}
+
+/**
+  * @brief  Reads an amount of data from the XSPI memory in indirect mode, with the
+  *         read command of the instance.
+  * @param  Instance  XSPI instance
+  * @param  pData     Pointer to data to be read
+  * @param  ReadAddr  Read start address
+  * @param  Size      Size of data to read
+  * @retval BSP status
+  */
+static int32_t XSPI_ReadData(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  XSPI_RegularCmdTypeDef s_command = {0};
+
+  /* The component read is used for the default read command */
+  if ((Xspi_Ctx[Instance].ReadCommand == BSP_XSPI_READ_DEFAULT) && (Xspi_Ctx[Instance].DummyCycles == 0U))
+  {
+    if (MX25R3235F_Read(&hxspi[Instance], Xspi_Ctx[Instance].InterfaceMode, pData, ReadAddr, Size) != MX25R3235F_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+  }
+  else
+  {
+    XSPI_InitReadCommand(Instance, &s_command, ReadAddr, Size);
+
+    if (HAL_XSPI_Command(&hxspi[Instance], &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else if (HAL_XSPI_Receive(&hxspi[Instance], pData, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      /* Read done */
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Configure the XSPI in memory-mapped mode with the read command of the instance.
+  * @param  Instance  XSPI instance
+  * @param  Option    Memory-mapped mode option
+  * @retval BSP status
+  */
+static int32_t XSPI_EnableMemoryMappedMode(uint32_t Instance, BSP_XSPI_MmpOption_t Option)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  XSPI_RegularCmdTypeDef s_command = {0};
+  XSPI_MemoryMappedTypeDef s_mem_mapped_cfg = {0};
+
+  /* The component configuration is used for the default read command */
+  if ((Xspi_Ctx[Instance].ReadCommand == BSP_XSPI_READ_DEFAULT) && (Xspi_Ctx[Instance].DummyCycles == 0U) &&
+      (Option == BSP_XSPI_MMP_DEFAULT))
+  {
+    if (MX25R3235F_EnableMemoryMappedMode(&hxspi[Instance], Xspi_Ctx[Instance].InterfaceMode) != MX25R3235F_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+  }
+  else
+  {
+    /* Read configuration */
+    XSPI_InitReadCommand(Instance, &s_command, 0U, 0U);
+    s_command.OperationType = HAL_XSPI_OPTYPE_READ_CFG;
+
+    /* Continuous read: the opcode is only sent with the first access */
+    if (Option == BSP_XSPI_MMP_CONTINUOUS_READ)
+    {
+      s_command.AlternateBytes = XSPI_NOR_MODE_PE;
+      s_command.SIOOMode       = HAL_XSPI_SIOO_INST_ONLY_FIRST_CMD;
+    }
+
+    if (HAL_XSPI_Command(&hxspi[Instance], &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      /* Write configuration */
+      XSPI_InitProgramCommand(Instance, &s_command, 0U, 0U);
+      s_command.OperationType = HAL_XSPI_OPTYPE_WRITE_CFG;
+
+      if (HAL_XSPI_Command(&hxspi[Instance], &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else
+      {
+        s_mem_mapped_cfg.TimeOutActivation = HAL_XSPI_TIMEOUT_COUNTER_DISABLE;
+
+        if (HAL_XSPI_MemoryMapped(&hxspi[Instance], &s_mem_mapped_cfg) != HAL_OK)
+        {
+          ret = BSP_ERROR_PERIPH_FAILURE;
+        }
+      }
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Aborts the memory-mapped mode, and takes the memory out of the continuous read
+  *         when it is used.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static int32_t XSPI_DisableMemoryMappedMode(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if (HAL_XSPI_Abort(&hxspi[Instance]) != HAL_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    Xspi_Ctx[Instance].IsInitialized = XSPI_ACCESS_INDIRECT;
+
+    if ((Xspi_Ctx[Instance].MmpOption == BSP_XSPI_MMP_CONTINUOUS_READ) &&
+        (XSPI_ExitContinuousRead(Instance) != BSP_ERROR_NONE))
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Takes the memory out of the performance enhance mode: a 4READ without opcode,
+  *         as expected by the memory in this mode, with non-toggling mode bits.
+  *         The frame does not depend on the instance context, so that it is also sent
+  *         before the reset commands: a memory left in this mode by a MCU reset would
+  *         take them for an address. Out of this mode, the memory sees a READ command.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static int32_t XSPI_ExitContinuousRead(uint32_t Instance)
+{
+  XSPI_RegularCmdTypeDef s_command = {0};
+  uint8_t data;
+
+  XSPI_InitCommand(&s_command, XSPI_NOR_CMD_4READ);
+  s_command.InstructionMode    = HAL_XSPI_INSTRUCTION_NONE;
+  s_command.AddressMode        = HAL_XSPI_ADDRESS_4_LINES;
+  s_command.Address            = 0U;
+  s_command.AlternateBytes     = XSPI_NOR_MODE_PE_EXIT;
+  s_command.AlternateBytesMode = HAL_XSPI_ALT_BYTES_4_LINES;
+  s_command.DataMode           = HAL_XSPI_DATA_4_LINES;
+  s_command.DummyCycles        = XSPI_NOR_DUMMY_4READ;
+  s_command.DataLength         = 1U;
+
+  if (HAL_XSPI_Command(&hxspi[Instance], &s_command, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  if (HAL_XSPI_Receive(&hxspi[Instance], &data, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  return BSP_ERROR_NONE;
+}
+
+#if (USE_BSP_XSPI_MMP_ARBITRATION == 1)
+/**
+  * @brief  Aborts the memory-mapped mode to run indirect commands.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static int32_t XSPI_MmpLeave(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+#if (USE_BSP_XSPI_STREAM == 1)
+  /* The window is in use by open cursors */
+  if (Xspi_Stream[Instance].Holds != 0U)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+  else
+#endif /* (USE_BSP_XSPI_STREAM == 1) */
+  if (Xspi_MmpLeft[Instance] != 0U)
+  {
+    /* Still left for an erase or a program: the XSPI is in indirect mode */
+    Xspi_Ctx[Instance].IsInitialized = XSPI_ACCESS_INDIRECT;
+  }
+  else
+  {
+    /* The memory-mapped mode option is kept to enter the mode again */
+    ret = XSPI_DisableMemoryMappedMode(Instance);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Enters again the memory-mapped mode after indirect commands, once the pending
+  *         write combining data is programmed. The end of an erase or a program is not
+  *         waited for: while the memory is not ready, or while the scheduler has work to
+  *         do, the XSPI stays in indirect mode and XSPI_MmpResume() enters the mode later.
+  *         The instance is in memory-mapped mode for the application in both cases.
+  * @param  Instance  XSPI instance
+  * @param  Status    Status of the indirect commands
+  * @retval Status if it is an error, else BSP status of the memory-mapped mode entry
+  */
+static int32_t XSPI_MmpReenter(uint32_t Instance, int32_t Status)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t ready = 1U;
+
+#if (USE_BSP_XSPI_SCHEDULER == 1)
+  /* The scheduler steps run in indirect mode */
+  if ((Xspi_Scheduler[Instance].Count != 0U) || (Xspi_Scheduler[Instance].pBusy != NULL) ||
+      (Xspi_Scheduler[Instance].pProgram != NULL))
+  {
+    ready = 0U;
+  }
+#endif /* (USE_BSP_XSPI_SCHEDULER == 1) */
+
+  if ((Status == BSP_ERROR_BUSY) || (Status == BSP_ERROR_XSPI_SUSPENDED))
+  {
+    /* Status of the memory just read by BSP_XSPI_GetStatus() */
+    ready = 0U;
+  }
+  else if ((ready != 0U) && (XSPI_GetStatus(Instance) != BSP_ERROR_NONE))
+  {
+    ready = 0U;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  if (ready == 0U)
+  {
+    Xspi_MmpLeft[Instance] = 1U;
+  }
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+  else if (XSPI_WriteCombineFlush(Instance, 0U, MX25R3235F_FLASH_SIZE) != BSP_ERROR_NONE)
+  {
+    Xspi_MmpLeft[Instance] = 1U;
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+  else if (XSPI_EnableMemoryMappedMode(Instance, Xspi_Ctx[Instance].MmpOption) != BSP_ERROR_NONE)
+  {
+    Xspi_MmpLeft[Instance] = 1U;
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+    Xspi_MmpLeft[Instance] = 0U;
+  }
+  Xspi_Ctx[Instance].IsInitialized = XSPI_ACCESS_MMP;
+
+#if (USE_BSP_XSPI_ICACHE == 1)
+  /* Drop the lines of the programmed or erased data */
+  if (HAL_ICACHE_Invalidate() != HAL_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+#endif /* (USE_BSP_XSPI_ICACHE == 1) */
+
+  return (Status != BSP_ERROR_NONE) ? Status : ret;
+}
+
+/**
+  * @brief  Enters again the memory-mapped mode left for an erase or a program, if the
+  *         memory is ready.
+  * @param  Instance  XSPI instance
+  * @retval BSP_ERROR_BUSY if the mode cannot be entered yet, else BSP status
+  */
+static int32_t XSPI_MmpResume(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if ((Xspi_Ctx[Instance].IsInitialized == XSPI_ACCESS_MMP) && (Xspi_MmpLeft[Instance] != 0U))
+  {
+    ret = XSPI_MmpLeave(Instance);
+    if (ret == BSP_ERROR_NONE)
+    {
+      ret = XSPI_MmpReenter(Instance, ret);
+    }
+    if ((ret == BSP_ERROR_NONE) && (Xspi_MmpLeft[Instance] != 0U))
+    {
+      ret = BSP_ERROR_BUSY;
+    }
+  }
+
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_MMP_ARBITRATION == 1) */
+
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+/**
+  * @brief  Records an access to the memory, and wakes it up first if it is in deep
+  *         power-down: the access is delayed by the wake-up time of the memory.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static int32_t XSPI_PowerAccess(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if (Xspi_Power[Instance].PowerDown != 0U)
+  {
+    /* nCS pulse of the NOP command wakes the memory up */
+    if (MX25R3235F_NoOperation(&hxspi[Instance]) != MX25R3235F_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      XSPI_DelayUs(XSPI_NOR_DP_WAKE_US);
+      XSPI_PowerSetState(Instance, 0U);
+    }
+  }
+
+  Xspi_Power[Instance].LastAccess = HAL_GetTick();
+
+  return ret;
+}
+
+/**
+  * @brief  Puts the memory in deep power-down once it has not been accessed for
+  *         BSP_XSPI_POWER_DOWN_TIMEOUT ms, with no operation on-going or pending.
+  *         Work left to do counts as an access.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static int32_t XSPI_PowerProcess(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t idle = 1U;
+  uint8_t reg[1];
+
+  if ((Xspi_Ctx[Instance].IsInitialized != XSPI_ACCESS_INDIRECT) || (Xspi_Power[Instance].PowerDown != 0U))
+  {
+    /* Memory-mapped accesses are not seen by the BSP: the memory stays awake */
+    idle = 0U;
+  }
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+  else if (Xspi_Async[Instance].State != XSPI_ASYNC_IDLE)
+  {
+    Xspi_Power[Instance].LastAccess = HAL_GetTick();
+    idle = 0U;
+  }
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+  else if (Xspi_WriteCombine[Instance].Pending != 0U)
+  {
+    idle = 0U;
+  }
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+#if (USE_BSP_XSPI_SCHEDULER == 1)
+  else if ((Xspi_Scheduler[Instance].Count != 0U) || (Xspi_Scheduler[Instance].pBusy != NULL))
+  {
+    /* Wake up the memory for the next step of the scheduler */
+    ret = XSPI_PowerAccess(Instance);
+    idle = 0U;
+  }
+#endif /* (USE_BSP_XSPI_SCHEDULER == 1) */
+  else if ((HAL_GetTick() - Xspi_Power[Instance].LastAccess) < BSP_XSPI_POWER_DOWN_TIMEOUT)
+  {
+    idle = 0U;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  if (idle != 0U)
+  {
+    /* A program or erase must not be on-going or suspended */
+    if ((MX25R3235F_ReadStatusRegister(&hxspi[Instance], reg) != MX25R3235F_OK) ||
+        ((reg[0] & MX25R3235F_SR_WIP) != 0U))
+    {
+      idle = 0U;
+    }
+    else if ((MX25R3235F_ReadSecurityRegister(&hxspi[Instance], reg) != MX25R3235F_OK) ||
+             ((reg[0] & (MX25R3235F_SECR_PSB | MX25R3235F_SECR_ESB)) != 0U))
+    {
+      idle = 0U;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+
+  if (idle != 0U)
+  {
+    if (MX25R3235F_EnterPowerDown(&hxspi[Instance]) != MX25R3235F_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      XSPI_PowerSetState(Instance, 1U);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Accounts the time spent in the current power state and changes the state.
+  * @param  Instance   XSPI instance
+  * @param  PowerDown  1 for the deep power-down, 0 for the awake state
+  * @retval None
+  */
+static void XSPI_PowerSetState(uint32_t Instance, uint32_t PowerDown)
+{
+  uint32_t tick = HAL_GetTick();
+
+  if (Xspi_Power[Instance].PowerDown != 0U)
+  {
+    Xspi_Power[Instance].Stats.PowerDownTime += tick - Xspi_Power[Instance].StateTick;
+    if (PowerDown == 0U)
+    {
+      Xspi_Power[Instance].Stats.WakeUps++;
+    }
+  }
+  else
+  {
+    Xspi_Power[Instance].Stats.ActiveTime += tick - Xspi_Power[Instance].StateTick;
+  }
+
+  Xspi_Power[Instance].StateTick = tick;
+  Xspi_Power[Instance].PowerDown = PowerDown;
+}
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) || (USE_BSP_XSPI_WARM_INIT == 1)
+/**
+  * @brief  Busy wait with the DWT cycle counter.
+  * @param  Delay  Delay in microseconds
+  * @retval None
+  */
+static void XSPI_DelayUs(uint32_t Delay)
+{
+  uint32_t start;
+  uint32_t cycles = Delay * (SystemCoreClock / 1000000U);
+
+  /* Enable the cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  start = DWT->CYCCNT;
+  while ((DWT->CYCCNT - start) < cycles)
+  {
+  }
+}
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) || (USE_BSP_XSPI_WARM_INIT == 1) */
+
+#if (USE_BSP_XSPI_STATS == 1)
+/**
+  * @brief  Starts the measure of a BSP function. Nested calls of BSP functions are
+  *         measured as a part of the outermost one.
+  * @param  Instance  XSPI instance
+  * @retval None
+  */
+static void XSPI_StatsStart(uint32_t Instance)
+{
+  if (Instance < XSPI_INSTANCES_NUMBER)
+  {
+    if (Xspi_Stats[Instance].Depth == 0U)
+    {
+      /* Enable the cycle counter */
+      CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+      DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+      Xspi_Stats[Instance].StartPolls  = Xspi_Stats[Instance].Stats.Polls;
+      Xspi_Stats[Instance].StartCycles = DWT->CYCCNT;
+    }
+    Xspi_Stats[Instance].Depth++;
+  }
+}
+
+/**
+  * @brief  Ends the measure of a BSP function and accounts it in the statistics
+  *         of its operation type.
+  * @param  Instance  XSPI instance
+  * @param  Op        Operation type
+  * @param  Size      Bytes read, written or erased
+  * @param  Status    BSP status of the function
+  * @retval None
+  */
+static void XSPI_StatsStop(uint32_t Instance, BSP_XSPI_StatsOp_t Op, uint32_t Size, int32_t Status)
+{
+  if ((Instance < XSPI_INSTANCES_NUMBER) && (Xspi_Stats[Instance].Depth != 0U))
+  {
+    Xspi_Stats[Instance].Depth--;
+
+    if (Xspi_Stats[Instance].Depth == 0U)
+    {
+      XSPI_StatsAccount(Instance, Op, Size, Status, DWT->CYCCNT - Xspi_Stats[Instance].StartCycles,
+                        Xspi_Stats[Instance].Stats.Polls - Xspi_Stats[Instance].StartPolls);
+    }
+  }
+}
+
+/**
+  * @brief  Ends the measure of a BSP function starting an operation which is measured
+  *         up to its end: an erase or an asynchronous transfer. Only a failed call is
+  *         accounted, the status polls of the call are accounted in any case.
+  * @param  Instance  XSPI instance
+  * @param  Op        Operation type
+  * @param  Status    BSP status of the function
+  * @retval None
+  */
+static void XSPI_StatsStopPending(uint32_t Instance, BSP_XSPI_StatsOp_t Op, int32_t Status)
+{
+  if (Status != BSP_ERROR_NONE)
+  {
+    XSPI_StatsStop(Instance, Op, 0U, Status);
+  }
+  else if ((Instance < XSPI_INSTANCES_NUMBER) && (Xspi_Stats[Instance].Depth != 0U))
+  {
+    Xspi_Stats[Instance].Depth--;
+
+    if (Xspi_Stats[Instance].Depth == 0U)
+    {
+      Xspi_Stats[Instance].Stats.Op[Op].Polls += Xspi_Stats[Instance].Stats.Polls - Xspi_Stats[Instance].StartPolls;
+    }
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+/**
+  * @brief  Accounts a measure in the statistics of its operation type. The statistics
+  *         are updated with the interrupts masked, since asynchronous operations end in
+  *         interrupt context.
+  * @param  Instance  XSPI instance
+  * @param  Op        Operation type
+  * @param  Size      Bytes read, written or erased
+  * @param  Status    BSP status of the operation
+  * @param  Cycles    Duration of the operation in CPU cycles
+  * @param  Polls     Status polls during the operation
+  * @retval None
+  */
+static void XSPI_StatsAccount(uint32_t Instance, BSP_XSPI_StatsOp_t Op, uint32_t Size, int32_t Status,
+                              uint32_t Cycles, uint32_t Polls)
+{
+  uint32_t bin = 0U;
+  uint32_t primask;
+  BSP_XSPI_OpStats_t *op_stats = &Xspi_Stats[Instance].Stats.Op[Op];
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  op_stats->Polls += Polls;
+
+  if (Status != BSP_ERROR_NONE)
+  {
+    op_stats->Errors++;
+  }
+  else
+  {
+    op_stats->Count++;
+    op_stats->Bytes       += Size;
+    op_stats->TotalCycles += Cycles;
+    if ((op_stats->Count == 1U) || (Cycles < op_stats->MinCycles))
+    {
+      op_stats->MinCycles = Cycles;
+    }
+    if (Cycles > op_stats->MaxCycles)
+    {
+      op_stats->MaxCycles = Cycles;
+    }
+
+    /* Bin n counts the latencies from 2^n to 2^(n+1) - 1 cycles */
+    if (Cycles != 0U)
+    {
+      bin = 31U - (uint32_t)__CLZ(Cycles);
+    }
+    op_stats->Histogram[bin]++;
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Starts the measure of an erase, at its command.
+  * @param  Instance  XSPI instance
+  * @param  Size      Bytes erased
+  * @retval None
+  */
+static void XSPI_StatsEraseStart(uint32_t Instance, uint32_t Size)
+{
+  /* Enable the cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  Xspi_Stats[Instance].EraseSize      = Size;
+  Xspi_Stats[Instance].EraseCycles    = DWT->CYCCNT;
+  Xspi_Stats[Instance].EraseTick      = HAL_GetTick();
+  Xspi_Stats[Instance].EraseSuspended = 0U;
+  Xspi_Stats[Instance].EraseOpen      = 1U;
+}
+
+/**
+  * @brief  Ends the measure of the erase, when the memory is seen ready out of an erase
+  *         suspend. An erase longer than the cycle counter period is accounted with the
+  *         largest duration.
+  * @param  Instance  XSPI instance
+  * @param  Status    BSP status of the erase
+  * @retval None
+  */
+static void XSPI_StatsEraseEnd(uint32_t Instance, int32_t Status)
+{
+  uint32_t cycles = DWT->CYCCNT - Xspi_Stats[Instance].EraseCycles;
+
+  if ((Xspi_Stats[Instance].EraseOpen != 0U) && (Xspi_Stats[Instance].EraseSuspended == 0U))
+  {
+    Xspi_Stats[Instance].EraseOpen = 0U;
+
+    if ((HAL_GetTick() - Xspi_Stats[Instance].EraseTick) >= (0xFFFFFFFFU / (SystemCoreClock / 1000U)))
+    {
+      cycles = 0xFFFFFFFFU;
+    }
+
+    XSPI_StatsAccount(Instance, BSP_XSPI_STATS_ERASE, Xspi_Stats[Instance].EraseSize, Status, cycles, 0U);
+  }
+}
+
+/**
+  * @brief  Marks the measured erase as suspended: the memory is then ready while the
+  *         erase is not over.
+  * @param  Instance   XSPI instance
+  * @param  Suspended  1 when the erase is suspended, 0 when it is resumed
+  * @retval None
+  */
+static void XSPI_StatsEraseSuspend(uint32_t Instance, uint32_t Suspended)
+{
+  Xspi_Stats[Instance].EraseSuspended = Suspended;
+}
+
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+/**
+  * @brief  Starts the measure of an asynchronous operation, before it is started.
+  * @param  Instance  XSPI instance
+  * @param  Size      Bytes read or written
+  * @retval None
+  */
+static void XSPI_StatsAsyncStart(uint32_t Instance, uint32_t Size)
+{
+  Xspi_Stats[Instance].AsyncSize   = Size;
+  Xspi_Stats[Instance].AsyncCycles = Xspi_Stats[Instance].StartCycles;
+}
+
+/**
+  * @brief  Ends the measure of an asynchronous operation, at its completion.
+  * @param  Instance  XSPI instance
+  * @param  Op        Operation type
+  * @param  Status    BSP status of the operation
+  * @retval None
+  */
+static void XSPI_StatsAsyncEnd(uint32_t Instance, BSP_XSPI_StatsOp_t Op, int32_t Status)
+{
+  XSPI_StatsAccount(Instance, Op, Xspi_Stats[Instance].AsyncSize, Status,
+                    DWT->CYCCNT - Xspi_Stats[Instance].AsyncCycles, 0U);
+}
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+
+#if (USE_BSP_XSPI_TRACE == 1)
+/**
+  * @brief  Starts the trace record of a BSP function. Nested calls of BSP functions are
+  *         recorded as a part of the outermost one. The nesting is tracked apart in thread
+  *         mode and in the interrupt handlers, so that a call from an interrupt handler is
+  *         recorded even if it interrupts a recorded call. The calls from interrupt handlers
+  *         of different priorities share their nesting.
+  * @param  Instance  XSPI instance
+  * @retval None
+  */
+static void XSPI_TraceStart(uint32_t Instance)
+{
+  uint32_t context = (__get_IPSR() != 0U) ? XSPI_TRACE_HANDLER : XSPI_TRACE_THREAD;
+
+  if (Instance < XSPI_INSTANCES_NUMBER)
+  {
+    if (Xspi_Trace[Instance].Depth[context] == 0U)
+    {
+      /* Enable the cycle counter */
+      CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+      DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+      Xspi_Trace[Instance].StartTick[context]   = HAL_GetTick();
+      Xspi_Trace[Instance].StartCycles[context] = DWT->CYCCNT;
+    }
+    Xspi_Trace[Instance].Depth[context]++;
+  }
+}
+
+/**
+  * @brief  Ends the trace record of a BSP function and writes it in the trace ring,
+  *         over the oldest record when the ring is full.
+  * @param  Instance  XSPI instance
+  * @param  Op        Operation type
+  * @param  Address   Memory address of the operation
+  * @param  Size      Bytes read, written or erased
+  * @param  Status    BSP status of the function
+  * @retval None
+  */
+static void XSPI_TraceStop(uint32_t Instance, BSP_XSPI_TraceOp_t Op, uint32_t Address, uint32_t Size,
+                           int32_t Status)
+{
+  BSP_XSPI_TraceRecord_t *record;
+  uint32_t context = (__get_IPSR() != 0U) ? XSPI_TRACE_HANDLER : XSPI_TRACE_THREAD;
+  uint32_t cycles;
+  uint32_t op = (uint32_t)Op;
+  uint32_t primask;
 
-  /* hxspi unused argument(s) compilation warning */
-  UNUSED(hxspi);
+  if ((Instance < XSPI_INSTANCES_NUMBER) && (Xspi_Trace[Instance].Depth[context] != 0U))
+  {
+    Xspi_Trace[Instance].Depth[context]--;
 
-  /* Enable the XSPI memory interface clock */
-  XSPI_CLK_ENABLE();
+    if (Xspi_Trace[Instance].Depth[context] == 0U)
+    {
+      cycles = DWT->CYCCNT - Xspi_Trace[Instance].StartCycles[context];
 
-  /* Reset the XSPI memory interface */
-  XSPI_FORCE_RESET();
-  XSPI_RELEASE_RESET();
+      /* Call from an interrupt handler during a recorded call: its cycles are in both records */
+      if ((context == XSPI_TRACE_HANDLER) && (Xspi_Trace[Instance].Depth[XSPI_TRACE_THREAD] != 0U))
+      {
+        op |= BSP_XSPI_TRACE_NESTED;
+      }
 
-  /* Enable GPIO clocks */
-  XSPI_CLK_GPIO_CLK_ENABLE();
-  XSPI_CS_GPIO_CLK_ENABLE();
-  XSPI_D0_GPIO_CLK_ENABLE();
-  XSPI_D1_GPIO_CLK_ENABLE();
-  XSPI_D2_GPIO_CLK_ENABLE();
-  XSPI_D3_GPIO_CLK_ENABLE();
+      /* The ring can also be written by a call from an interrupt handler */
+      primask = __get_PRIMASK();
+      __disable_irq();
 
-  /* XSPI CS GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = XSPI_CS_PIN;
-  GPIO_InitStruct.Mode      = GPIO_MODE_AF_PP;
-  GPIO_InitStruct.Pull      = GPIO_PULLUP;
-  GPIO_InitStruct.Speed     = GPIO_SPEED_FREQ_HIGH;
-  GPIO_InitStruct.Alternate = XSPI_CS_PIN_AF;
-  HAL_GPIO_Init(XSPI_CS_GPIO_PORT, &GPIO_InitStruct);
+      record = &Xspi_Trace[Instance].Records[Xspi_Trace[Instance].Count % BSP_XSPI_TRACE_DEPTH];
+
+      record->Tick     = Xspi_Trace[Instance].StartTick[context];
+      record->Cycles   = cycles;
+      record->Address  = Address;
+      record->Size     = Size;
+      record->Sequence = (uint16_t)Xspi_Trace[Instance].Count;
+      record->Op       = (uint8_t)op;
+      record->Status   = (int8_t)Status;
+
+      Xspi_Trace[Instance].Count++;
+
+      __set_PRIMASK(primask);
+    }
+  }
+}
+
+/**
+  * @brief  Ends the trace record of a BSP function without writing it in the trace ring.
+  * @param  Instance  XSPI instance
+  * @retval None
+  */
+static void XSPI_TraceDrop(uint32_t Instance)
+{
+  uint32_t context = (__get_IPSR() != 0U) ? XSPI_TRACE_HANDLER : XSPI_TRACE_THREAD;
+
+  if ((Instance < XSPI_INSTANCES_NUMBER) && (Xspi_Trace[Instance].Depth[context] != 0U))
+  {
+    Xspi_Trace[Instance].Depth[context]--;
+  }
+}
+
+/**
+  * @brief  Checks if the last record of the trace ring is an operation with a status.
+  * @param  Instance  XSPI instance
+  * @param  Op        Operation type
+  * @param  Status    BSP status
+  * @retval 1 if the last record matches, 0 otherwise
+  */
+static uint32_t XSPI_TraceIsLast(uint32_t Instance, BSP_XSPI_TraceOp_t Op, int32_t Status)
+{
+  uint32_t ret = 0U;
+  const BSP_XSPI_TraceRecord_t *record;
+
+  if ((Instance < XSPI_INSTANCES_NUMBER) && (Xspi_Trace[Instance].Count != 0U))
+  {
+    record = &Xspi_Trace[Instance].Records[(Xspi_Trace[Instance].Count - 1U) % BSP_XSPI_TRACE_DEPTH];
+    if ((record->Op == (uint8_t)Op) && (record->Status == (int8_t)Status))
+    {
+      ret = 1U;
+    }
+  }
+
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+
+#if (USE_BSP_XSPI_ICACHE == 1)
+/**
+  * @brief  Maps the memory-mapped window on its ICACHE remap region and invalidates the cache.
+  *         The remap region can only be changed with the ICACHE disabled: the ICACHE is left
+  *         enabled or disabled as found, also on error. The previous region is removed
+  *         before the new one is set.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static int32_t XSPI_ICacheEnable(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  ICACHE_RegionConfigTypeDef region_cfg = {0};
+  uint32_t enabled = READ_BIT(ICACHE->CR, ICACHE_CR_EN);
+
+  region_cfg.BaseAddress     = Xspi_ICacheConfig[Instance].BaseAddress;
+  region_cfg.RemapAddress    = XSPI1_BASE;
+  region_cfg.Size            = Xspi_ICacheConfig[Instance].RegionSize;
+  region_cfg.TrafficRoute    = ICACHE_MASTER2_PORT;
+  region_cfg.OutputBurstType = Xspi_ICacheConfig[Instance].OutputBurstType;
+
+  if (HAL_ICACHE_Disable() != HAL_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else if (HAL_ICACHE_DisableRemapRegion(ICACHE_REGION_0) != HAL_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else if (HAL_ICACHE_EnableRemapRegion(ICACHE_REGION_0, &region_cfg) != HAL_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else if (HAL_ICACHE_Invalidate() != HAL_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  /* Restore the ICACHE state */
+  if ((enabled != 0U) && (HAL_ICACHE_Enable() != HAL_OK))
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Removes the ICACHE remap region of the memory-mapped window.
+  *         Disabling the ICACHE invalidates it, and it is left enabled or disabled as found,
+  *         also on error.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static int32_t XSPI_ICacheDisable(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t enabled = READ_BIT(ICACHE->CR, ICACHE_CR_EN);
+
+  UNUSED(Instance);
+
+  if (HAL_ICACHE_Disable() != HAL_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else if (HAL_ICACHE_DisableRemapRegion(ICACHE_REGION_0) != HAL_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  /* Restore the ICACHE state */
+  if ((enabled != 0U) && (HAL_ICACHE_Enable() != HAL_OK))
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_ICACHE == 1) */
+
+#if (USE_BSP_XSPI_ICACHE == 1) && (USE_BSP_XSPI_BENCHMARK == 1)
+/**
+  * @brief  Reads an area XSPI_ICACHE_BENCH_LOOPS times by words.
+  * @param  pArea  Start of the area
+  * @param  Size   Size of the area in bytes
+  * @retval CPU cycles of the reads
+  */
+static uint32_t XSPI_MeasureRead(const uint32_t *pArea, uint32_t Size)
+{
+  __IO uint32_t sum = 0U;
+  uint32_t start;
+  uint32_t loop;
+  uint32_t index;
+
+  start = DWT->CYCCNT;
+  for (loop = 0U; loop < XSPI_ICACHE_BENCH_LOOPS; loop++)
+  {
+    for (index = 0U; index < (Size / 4U); index++)
+    {
+      sum += pArea[index];
+    }
+  }
+
+  return DWT->CYCCNT - start;
+}
+#endif /* (USE_BSP_XSPI_ICACHE == 1) && (USE_BSP_XSPI_BENCHMARK == 1) */
+
+#if (USE_BSP_XSPI_WARM_INIT == 1)
+/**
+  * @brief  Completes the warm init: restores the saved timing and context once the memory
+  *         is checked. The nCS pulse of the continuous read exit also wakes the memory up
+  *         from deep power-down. The memory must then answer its identification, be ready
+  *         with the QE bit of the saved interface mode, and be in the saved power mode:
+  *         an absent or unpowered memory reads all zeros and fails the identification.
+  * @param  Instance  XSPI instance
+  * @retval BSP status
+  */
+static int32_t XSPI_WarmInit(uint32_t Instance)
+{
+  int32_t ret;
+  uint8_t id[3];
+  uint8_t reg[2];
+  uint8_t expected = (Xspi_SavedCtx[Instance].InterfaceMode == BSP_XSPI_QPI_MODE) ? MX25R3235F_SR_QE : 0U;
+  uint8_t lh_switch = (Xspi_SavedCtx[Instance].PerformanceMode == BSP_XSPI_HIGH_PERFORMANCE_MODE) ?
+                      XSPI_NOR_CR2_LH_SWITCH : 0U;
+
+  /* Saved clock prescaler, sample shifting, delay hold and delay block phase */
+  ret = XSPI_ApplyTiming(Instance, &Xspi_SavedCtx[Instance].Timing);
+
+  if (ret == BSP_ERROR_NONE)
+  {
+    /* Exit the continuous read, and the deep power-down */
+    if (XSPI_ExitContinuousRead(Instance) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      XSPI_DelayUs(XSPI_NOR_DP_WAKE_US);
+
+      if (MX25R3235F_ReadID(&hxspi[Instance], id) != MX25R3235F_OK)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+      else if ((id[0] != XSPI_NOR_ID_MANUFACTURER) || (id[1] != XSPI_NOR_ID_TYPE) ||
+               (id[2] != XSPI_NOR_ID_DENSITY))
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+      else if (MX25R3235F_ReadStatusRegister(&hxspi[Instance], reg) != MX25R3235F_OK)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+      else if ((reg[0] & (MX25R3235F_SR_WIP | MX25R3235F_SR_WEL | MX25R3235F_SR_QE)) != expected)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+      else if (XSPI_ReadConfigRegister(Instance, reg) != BSP_ERROR_NONE)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+      else if ((reg[1] & XSPI_NOR_CR2_LH_SWITCH) != lh_switch)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+      else
+      {
+        /* Memory in the saved state */
+      }
+    }
+
+    if (ret == BSP_ERROR_NONE)
+    {
+      Xspi_Ctx[Instance].IsInitialized   = XSPI_ACCESS_INDIRECT;
+      Xspi_Ctx[Instance].InterfaceMode   = Xspi_SavedCtx[Instance].InterfaceMode;
+      Xspi_Ctx[Instance].PerformanceMode = Xspi_SavedCtx[Instance].PerformanceMode;
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+      XSPI_CacheInvalidate(Instance, 0U, MX25R3235F_FLASH_SIZE);
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+      Xspi_Power[Instance].PowerDown  = 0U;
+      Xspi_Power[Instance].StateTick  = HAL_GetTick();
+      Xspi_Power[Instance].LastAccess = Xspi_Power[Instance].StateTick;
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+    }
+  }
+
+  return ret;
+}
+#endif /* (USE_BSP_XSPI_WARM_INIT == 1) */
+
+/**
+  * @brief  Reads the current timing settings of the XSPI.
+  * @param  Instance  XSPI instance
+  * @param  pTiming   Pointer to the timing settings
+  * @retval None
+  */
+static void XSPI_GetTiming(uint32_t Instance, BSP_XSPI_Calibration_t *pTiming)
+{
+  HAL_XSPI_DLYB_CfgTypeDef dlyb_cfg = {0};
+
+  (void)HAL_XSPI_DLYB_GetConfig(&hxspi[Instance], &dlyb_cfg);
+
+  pTiming->ClockPrescaler        = hxspi[Instance].Init.ClockPrescaler;
+  pTiming->SampleShifting        = hxspi[Instance].Init.SampleShifting;
+  pTiming->DelayHoldQuarterCycle = hxspi[Instance].Init.DelayHoldQuarterCycle;
+  pTiming->DlybPhaseSel          = dlyb_cfg.PhaseSel;
+}
+
+/**
+  * @brief  Re-initializes the XSPI with new timing settings.
+  * @param  Instance  XSPI instance
+  * @param  pTiming   Pointer to the timing settings, a DlybPhaseSel of 0 selects the
+  *                   default delay block setting for the clock
+  * @retval BSP status
+  */
+static int32_t XSPI_ApplyTiming(uint32_t Instance, const BSP_XSPI_Calibration_t *pTiming)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  MX_XSPI_InitTypeDef xspi_init;
+  HAL_XSPI_DLYB_CfgTypeDef dlyb_cfg;
+
+  xspi_init.ClockPrescaler = pTiming->ClockPrescaler;
+  xspi_init.MemorySize     = hxspi[Instance].Init.MemorySize;
+  xspi_init.SampleShifting = pTiming->SampleShifting;
+
+  if (MX_XSPI_Init(&hxspi[Instance], &xspi_init) != HAL_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else if (hxspi[Instance].Init.DelayHoldQuarterCycle != pTiming->DelayHoldQuarterCycle)
+  {
+    /* The delay hold is only changed by the calibration: set it over the MX_XSPI_Init() settings */
+    hxspi[Instance].Init.DelayHoldQuarterCycle = pTiming->DelayHoldQuarterCycle;
+    if (HAL_XSPI_Init(&hxspi[Instance]) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+  }
+  else
+  {
+    /* Delay hold of MX_XSPI_Init() kept */
+  }
+
+  if (ret == BSP_ERROR_NONE)
+  {
+    if (pTiming->DlybPhaseSel == 0U)
+    {
+      XSPI_DLYB_Enable(Instance);
+    }
+    else
+    {
+      /* The delay block length depends on the clock period */
+      (void)HAL_XSPI_DLYB_GetClockPeriod(&hxspi[Instance], &dlyb_cfg);
+      dlyb_cfg.PhaseSel = pTiming->DlybPhaseSel;
+
+      if (HAL_XSPI_DLYB_SetConfig(&hxspi[Instance], &dlyb_cfg) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+    }
+  }
+
+  return ret;
+}
+
+#if (USE_BSP_XSPI_BENCHMARK == 1)
+/**
+  * @brief  Erases the 4KB sector at Address, then measures the time to program it.
+  * @param  Instance         XSPI instance
+  * @param  Address          Address of the sector
+  * @param  pBytesPerSecond  Measured program throughput
+  * @retval BSP status
+  */
+static int32_t XSPI_MeasureProgram(uint32_t Instance, uint32_t Address, uint32_t *pBytesPerSecond)
+{
+  int32_t ret;
+  uint8_t pattern[MX25R3235F_PAGE_SIZE];
+  uint32_t offset;
+  uint32_t start;
+  uint32_t cycles;
+
+  for (offset = 0U; offset < MX25R3235F_PAGE_SIZE; offset++)
+  {
+    pattern[offset] = (uint8_t)offset;
+  }
+
+  ret = BSP_XSPI_Erase_Block(Instance, Address, BSP_XSPI_ERASE_4K);
+  if ((ret == BSP_ERROR_NONE) &&
+      (XSPI_AutoPollingMemReady(Instance, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != BSP_ERROR_NONE))
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  if (ret == BSP_ERROR_NONE)
+  {
+    start = DWT->CYCCNT;
+    for (offset = 0U; (offset < BSP_XSPI_BLOCK_4K) && (ret == BSP_ERROR_NONE); offset += MX25R3235F_PAGE_SIZE)
+    {
+      ret = XSPI_Write(Instance, pattern, Address + offset, MX25R3235F_PAGE_SIZE);
+    }
+    cycles = DWT->CYCCNT - start;
+
+    if ((ret == BSP_ERROR_NONE) && (cycles != 0U))
+    {
+      *pBytesPerSecond = (uint32_t)(((uint64_t)BSP_XSPI_BLOCK_4K * SystemCoreClock) / cycles);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Checks the clock prescalers of a program benchmark: no clock above the one
+  *         of the performance mode of the memory.
+  * @param  Instance   XSPI instance
+  * @param  pResults   Results array
+  * @param  NbResults  Number of entries of the results array
+  * @retval BSP status
+  */
+static int32_t XSPI_BenchCheckPrescalers(uint32_t Instance, const BSP_XSPI_ProgramBench_t *pResults,
+                                         uint32_t NbResults)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t min_prescaler;
+  uint32_t index;
+
+  min_prescaler = (Xspi_Ctx[Instance].PerformanceMode == BSP_XSPI_HIGH_PERFORMANCE_MODE) ?
+                  BSP_XSPI_HP_PRESCALER : BSP_XSPI_ULP_PRESCALER;
+
+  for (index = 0U; (index < NbResults) && (ret == BSP_ERROR_NONE); index++)
+  {
+    if ((pResults[index].ClockPrescaler < min_prescaler) || (pResults[index].ClockPrescaler > XSPI_PRESCALER_MAX))
+    {
+      ret = BSP_ERROR_WRONG_PARAM;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Returns the latency histogram bin of a duration. The durations below
+  *         XSPI_BENCH_SUB_BINS cycles have a bin each, and each power of two above is
+  *         split in XSPI_BENCH_SUB_BINS bins, so the bin width is at most 1/8 of its start.
+  * @param  Cycles  Duration in CPU cycles
+  * @retval Bin index, below XSPI_BENCH_BINS
+  */
+static uint32_t XSPI_BenchBin(uint32_t Cycles)
+{
+  uint32_t bin = Cycles;
+  uint32_t msb;
 
-  /* XSPI CLK GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = XSPI_CLK_PIN;
-  GPIO_InitStruct.Pull      = GPIO_NOPULL;
-  GPIO_InitStruct.Alternate = XSPI_CLK_PIN_AF;
-  HAL_GPIO_Init(XSPI_CLK_GPIO_PORT, &GPIO_InitStruct);
+  if (Cycles >= XSPI_BENCH_SUB_BINS)
+  {
+    /* Power of two of the duration, and its 3 next bits */
+    msb = 31U - (uint32_t)__CLZ(Cycles);
+    bin = ((msb - 2U) * XSPI_BENCH_SUB_BINS) + ((Cycles >> (msb - 3U)) & (XSPI_BENCH_SUB_BINS - 1U));
+  }
 
-  /* XSPI D0 GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = XSPI_D0_PIN;
-  GPIO_InitStruct.Alternate = XSPI_D0_PIN_AF;
-  HAL_GPIO_Init(XSPI_D0_GPIO_PORT, &GPIO_InitStruct);
+  return bin;
+}
 
-  /* XSPI D1 GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = XSPI_D1_PIN;
-  GPIO_InitStruct.Alternate = XSPI_D1_PIN_AF;
-  HAL_GPIO_Init(XSPI_D1_GPIO_PORT, &GPIO_InitStruct);
+/**
+  * @brief  Returns the largest duration of a latency histogram bin.
+  * @param  Bin  Bin index
+  * @retval Duration in CPU cycles
+  */
+static uint32_t XSPI_BenchBinEdge(uint32_t Bin)
+{
+  uint32_t edge = Bin;
+  uint32_t shift;
 
-  /* XSPI D2 GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = XSPI_D2_PIN;
-  GPIO_InitStruct.Alternate = XSPI_D2_PIN_AF;
-  HAL_GPIO_Init(XSPI_D2_GPIO_PORT, &GPIO_InitStruct);
+  if (Bin >= XSPI_BENCH_SUB_BINS)
+  {
+    shift = (Bin / XSPI_BENCH_SUB_BINS) - 1U;
+    edge  = (uint32_t)((((uint64_t)XSPI_BENCH_SUB_BINS + (Bin % XSPI_BENCH_SUB_BINS) + 1U) << shift) - 1U);
+  }
 
-  /* XSPI D3 GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = XSPI_D3_PIN;
-  GPIO_InitStruct.Alternate = XSPI_D3_PIN_AF;
-  HAL_GPIO_Init(XSPI_D3_GPIO_PORT, &GPIO_InitStruct);
+  return edge;
 }
+#endif /* (USE_BSP_XSPI_BENCHMARK == 1) */
 
+#if (USE_BSP_XSPI_CALIBRATION == 1)
 /**
-  * @brief  De-Initializes the XSPI MSP.
-  * @param  hxspi XSPI handle
-  * @retval None
+  * @brief  Returns a byte of the calibration pattern: counter, alternate bits,
+  *         walking ones and walking zeros, to stress all the data lines.
+  * @param  Index  Byte index in the page
+  * @retval Pattern byte
   */
-static void XSPI_MspDeInit(XSPI_HandleTypeDef *hxspi)
+static uint8_t XSPI_CalibPattern(uint32_t Index)
 {
-  /* hxspi unused argument(s) compilation warning */
-  UNUSED(hxspi);
+  uint8_t value;
 
-  /* XSPI GPIO pins de-configuration  */
-  HAL_GPIO_DeInit(XSPI_CLK_GPIO_PORT, XSPI_CLK_PIN);
-  HAL_GPIO_DeInit(XSPI_CS_GPIO_PORT, XSPI_CS_PIN);
-  HAL_GPIO_DeInit(XSPI_D0_GPIO_PORT, XSPI_D0_PIN);
-  HAL_GPIO_DeInit(XSPI_D1_GPIO_PORT, XSPI_D1_PIN);
-  HAL_GPIO_DeInit(XSPI_D2_GPIO_PORT, XSPI_D2_PIN);
-  HAL_GPIO_DeInit(XSPI_D3_GPIO_PORT, XSPI_D3_PIN);
+  switch (Index / 64U)
+  {
+    case 0U :
+      value = (uint8_t)Index;
+      break;
 
-  /* Reset the XSPI memory interface */
-  XSPI_FORCE_RESET();
-  XSPI_RELEASE_RESET();
+    case 1U :
+      value = ((Index % 2U) == 0U) ? 0x55U : 0xAAU;
+      break;
 
-  /* Disable the XSPI memory interface clock */
-  XSPI_CLK_DISABLE();
+    case 2U :
+      value = (uint8_t)(1UL << (Index % 8U));
+      break;
+
+    default :
+      value = (uint8_t)~(1UL << (Index % 8U));
+      break;
+  }
+
+  return value;
 }
 
 /**
-  * @brief  This function reset the XSPI memory.
+  * @brief  Erases the 4KB sector at Address and programs the calibration pattern in its first page.
   * @param  Instance  XSPI instance
+  * @param  Address   Address of the calibration sector
   * @retval BSP status
   */
-static int32_t XSPI_ResetMemory(uint32_t Instance)
+static int32_t XSPI_CalibWritePattern(uint32_t Instance, uint32_t Address)
 {
-  int32_t ret = BSP_ERROR_NONE;
+  int32_t ret;
+  uint8_t pattern[MX25R3235F_PAGE_SIZE];
+  uint32_t index;
 
-  if (MX25R3235F_ResetEnable(&hxspi[Instance]) != MX25R3235F_OK)
+  for (index = 0U; index < MX25R3235F_PAGE_SIZE; index++)
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    pattern[index] = XSPI_CalibPattern(index);
   }
-  else if (MX25R3235F_ResetMemory(&hxspi[Instance]) != MX25R3235F_OK)
+
+  ret = BSP_XSPI_Erase_Block(Instance, Address, BSP_XSPI_ERASE_4K);
+  if (ret == BSP_ERROR_NONE)
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    ret = XSPI_Write(Instance, pattern, Address, MX25R3235F_PAGE_SIZE);
   }
-  else
+
+  return ret;
+}
+
+/**
+  * @brief  Reads back the calibration pattern BSP_XSPI_CALIB_READS times.
+  * @param  Instance  XSPI instance
+  * @param  Address   Address of the calibration sector
+  * @retval 1 if all the reads match the pattern, else 0
+  */
+static uint32_t XSPI_CalibCheckPattern(uint32_t Instance, uint32_t Address)
+{
+  uint8_t data[MX25R3235F_PAGE_SIZE];
+  uint32_t read;
+  uint32_t index;
+  uint32_t pass = 1U;
+
+  for (read = 0U; (read < BSP_XSPI_CALIB_READS) && (pass != 0U); read++)
   {
-    Xspi_Ctx[Instance].IsInitialized = XSPI_ACCESS_INDIRECT;     /* After reset S/W setting to indirect access  */
-    Xspi_Ctx[Instance].InterfaceMode = BSP_XSPI_SPI_MODE;    /* After reset H/W back to SPI mode by default */
+    if (XSPI_ReadData(Instance, data, Address, MX25R3235F_PAGE_SIZE) != BSP_ERROR_NONE)
+    {
+      pass = 0U;
+    }
 
-    /* Wait SWreset CMD is effective and check that memory is ready */
-    if (XSPI_AutoPollingMemReady(&hxspi[Instance]) != BSP_ERROR_NONE)
+    for (index = 0U; (index < MX25R3235F_PAGE_SIZE) && (pass != 0U); index++)
     {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
+      if (data[index] != XSPI_CalibPattern(index))
+      {
+        pass = 0U;
+      }
     }
   }
 
-  /* Return BSP status */
-  return ret;
+  return pass;
 }
 
 /**
-  * @brief  This function enables the quad mode of the memory.
+  * @brief  Sweeps the delay block phase over one clock period for the prescaler, sample
+  *         shifting and delay hold settings of pTiming, and sets its DlybPhaseSel to the
+  *         center of the largest window of phases reading the pattern correctly.
+  *         Each delay cell of the clock period measured by the delay block is tried.
   * @param  Instance  XSPI instance
-  * @retval BSP status
+  * @param  Address   Address of the calibration sector
+  * @param  pTiming   Pointer to the timing settings
+  * @retval Number of phases of the largest passing window, 0 if none
   */
-static int32_t XSPI_EnterQPIMode(uint32_t Instance)
+static uint32_t XSPI_CalibSweepPhase(uint32_t Instance, uint32_t Address, BSP_XSPI_Calibration_t *pTiming)
 {
-  uint8_t reg;
-
-  if (MX25R3235F_ReadStatusRegister(&hxspi[Instance], &reg) != MX25R3235F_OK)
+  HAL_XSPI_DLYB_CfgTypeDef dlyb_cfg = {0};
+  uint32_t period;
+  uint32_t phase;
+  uint32_t window = 0U;
+  uint32_t best_window = 0U;
+  uint32_t best_end = 0U;
+
+  /* Delay cells of one clock period */
+  pTiming->DlybPhaseSel = 0U;
+  if (XSPI_ApplyTiming(Instance, pTiming) == BSP_ERROR_NONE)
   {
-    return BSP_ERROR_COMPONENT_FAILURE;
+    (void)HAL_XSPI_DLYB_GetClockPeriod(&hxspi[Instance], &dlyb_cfg);
   }
+  period = (dlyb_cfg.PhaseSel < XSPI_DLYB_PHASE_NBR) ? dlyb_cfg.PhaseSel : XSPI_DLYB_PHASE_NBR;
 
-  /* Enable write operations */
-  if (MX25R3235F_WriteEnable(&hxspi[Instance]) != MX25R3235F_OK)
+  for (phase = 1U; phase < period; phase++)
   {
-    return BSP_ERROR_COMPONENT_FAILURE;
-  }
-
-  /* Activate/deactivate the Quad mode */
-  SET_BIT(reg, MX25R3235F_SR_QE);
+    pTiming->DlybPhaseSel = phase;
 
-  if (MX25R3235F_WriteStatusRegister(&hxspi[Instance], reg) != MX25R3235F_OK)
-  {
-    return BSP_ERROR_COMPONENT_FAILURE;
+    if ((XSPI_ApplyTiming(Instance, pTiming) == BSP_ERROR_NONE) && (XSPI_CalibCheckPattern(Instance, Address) != 0U))
+    {
+      window++;
+      if (window > best_window)
+      {
+        best_window = window;
+        best_end    = phase;
+      }
+    }
+    else
+    {
+      window = 0U;
+    }
   }
 
-  /* Wait that memory is ready */
-  if (XSPI_AutoPollingMemReady(&hxspi[Instance]) != BSP_ERROR_NONE)
+  if (best_window != 0U)
   {
-    return BSP_ERROR_COMPONENT_FAILURE;
+    pTiming->DlybPhaseSel = best_end - (best_window / 2U);
   }
 
-  if (MX25R3235F_ReadStatusRegister(&hxspi[Instance], &reg) != MX25R3235F_OK)
+  return best_window;
+}
+#endif /* (USE_BSP_XSPI_CALIBRATION == 1) */
+
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+/**
+  * @brief  Start the XSPI auto-polling of the WIP bit under interrupt.
+  *         The status match interrupt is raised once the memory is ready.
+  * @param  Instance  XSPI instance
+  * @param  Timeout   Timeout of the wait for the XSPI to be free, in ms
+  * @retval BSP status
+  */
+static int32_t XSPI_StartAutoPolling(uint32_t Instance, uint32_t Timeout)
+{
+  XSPI_RegularCmdTypeDef  s_command = {0};
+  XSPI_AutoPollingTypeDef s_config  = {0};
+
+  /* Configure the status register read command */
+  XSPI_InitCommand(&s_command, XSPI_NOR_CMD_RDSR);
+  s_command.DataMode   = HAL_XSPI_DATA_1_LINE;
+  s_command.DataLength = 1U;
+
+  /* Wait for WIP bit cleared */
+  s_config.MatchValue    = 0U;
+  s_config.MatchMask     = MX25R3235F_SR_WIP;
+  s_config.MatchMode     = HAL_XSPI_MATCH_MODE_AND;
+  s_config.IntervalTime  = XSPI_AUTOPOLLING_INTERVAL;
+  s_config.AutomaticStop = HAL_XSPI_AUTOMATIC_STOP_ENABLE;
+
+  if (HAL_XSPI_Command(&hxspi[Instance], &s_command, Timeout) != HAL_OK)
   {
-    return BSP_ERROR_COMPONENT_FAILURE;
+    return BSP_ERROR_PERIPH_FAILURE;
   }
 
-  if ((reg & MX25R3235F_SR_QE) == 0)
+  if (HAL_XSPI_AutoPolling_IT(&hxspi[Instance], &s_config) != HAL_OK)
   {
-    return BSP_ERROR_COMPONENT_FAILURE;
+    return BSP_ERROR_PERIPH_FAILURE;
   }
 
   return BSP_ERROR_NONE;
 }
 
 /**
-  * @brief  This function disables the quad mode of the memory.
+  * @brief  Checks if an asynchronous operation is on-going. An operation still running
+  *         after its deadline is aborted and completed with BSP_ERROR_COMPONENT_FAILURE.
   * @param  Instance  XSPI instance
-  * @retval BSP status
+  * @retval BSP_ERROR_BUSY if an asynchronous operation is on-going, else BSP_ERROR_NONE
   */
-static int32_t XSPI_ExitQPIMode(uint32_t Instance)
+static int32_t XSPI_AsyncCheck(uint32_t Instance)
 {
-  uint8_t reg;
+  int32_t ret = BSP_ERROR_NONE;
 
-  if (MX25R3235F_ReadStatusRegister(&hxspi[Instance], &reg) != MX25R3235F_OK)
+  if (Xspi_Async[Instance].State != XSPI_ASYNC_IDLE)
   {
-    return BSP_ERROR_COMPONENT_FAILURE;
+    if ((HAL_GetTick() - Xspi_Async[Instance].StartTick) <= Xspi_Async[Instance].Timeout)
+    {
+      ret = BSP_ERROR_BUSY;
+    }
+    else
+    {
+      /* Mask the interrupts chaining the steps while the operation is aborted */
+      HAL_NVIC_DisableIRQ(XSPI_IRQn);
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+      HAL_NVIC_DisableIRQ(XSPI_DMA_RX_IRQn);
+      HAL_NVIC_DisableIRQ(XSPI_DMA_TX_IRQn);
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+
+      /* The last step may have completed meanwhile */
+      if (Xspi_Async[Instance].State != XSPI_ASYNC_IDLE)
+      {
+        (void)HAL_XSPI_Abort(&hxspi[Instance]);
+        XSPI_AsyncComplete(Instance, BSP_ERROR_COMPONENT_FAILURE);
+      }
+
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+      HAL_NVIC_EnableIRQ(XSPI_DMA_RX_IRQn);
+      HAL_NVIC_EnableIRQ(XSPI_DMA_TX_IRQn);
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+      HAL_NVIC_EnableIRQ(XSPI_IRQn);
+    }
   }
 
-  /* Enable write operations */
-  if (MX25R3235F_WriteEnable(&hxspi[Instance]) != MX25R3235F_OK)
+  return ret;
+}
+
+/**
+  * @brief  Get the BSP instance associated to a XSPI handle.
+  * @param  pHxspi XSPI handle
+  * @retval XSPI instance
+  */
+static uint32_t XSPI_GetInstance(const XSPI_HandleTypeDef *pHxspi)
+{
+  /* XSPI handles are stored in the hxspi[] array indexed by instance */
+  return (uint32_t)(pHxspi - &hxspi[0]);
+}
+
+/**
+  * @brief  XSPI status match callback: the memory is ready.
+  * @param  pHxspi XSPI handle
+  * @retval None
+  */
+static void XSPI_StatusMatchCallback(XSPI_HandleTypeDef *pHxspi)
+{
+  uint32_t instance = XSPI_GetInstance(pHxspi);
+
+  if (Xspi_Async[instance].State != XSPI_ASYNC_IDLE)
   {
-    return BSP_ERROR_COMPONENT_FAILURE;
+    XSPI_AsyncProcess(instance);
+  }
+  else
+  {
+    Xspi_PollStatus[instance] = BSP_ERROR_NONE;
   }
+}
 
-  /* Activate/deactivate the Quad mode */
-  CLEAR_BIT(reg, MX25R3235F_SR_QE);
+/**
+  * @brief  XSPI command complete callback.
+  * @param  pHxspi XSPI handle
+  * @retval None
+  */
+static void XSPI_CmdCpltCallback(XSPI_HandleTypeDef *pHxspi)
+{
+  uint32_t instance = XSPI_GetInstance(pHxspi);
 
-  if (MX25R3235F_WriteStatusRegister(&hxspi[Instance], reg) != MX25R3235F_OK)
+  if (Xspi_Async[instance].State != XSPI_ASYNC_IDLE)
   {
-    return BSP_ERROR_COMPONENT_FAILURE;
+    XSPI_AsyncProcess(instance);
   }
+}
 
-  /* Wait that memory is ready */
-  if (XSPI_AutoPollingMemReady(&hxspi[Instance]) != BSP_ERROR_NONE)
+/**
+  * @brief  XSPI Tx transfer complete callback.
+  * @param  pHxspi XSPI handle
+  * @retval None
+  */
+static void XSPI_TxCpltCallback(XSPI_HandleTypeDef *pHxspi)
+{
+  uint32_t instance = XSPI_GetInstance(pHxspi);
+
+  if (Xspi_Async[instance].State != XSPI_ASYNC_IDLE)
   {
-    return BSP_ERROR_COMPONENT_FAILURE;
+    XSPI_AsyncProcess(instance);
   }
+}
 
-  if (MX25R3235F_ReadStatusRegister(&hxspi[Instance], &reg) != MX25R3235F_OK)
+/**
+  * @brief  XSPI error callback.
+  * @param  pHxspi XSPI handle
+  * @retval None
+  */
+static void XSPI_ErrorCallback(XSPI_HandleTypeDef *pHxspi)
+{
+  uint32_t instance = XSPI_GetInstance(pHxspi);
+
+  if (Xspi_Async[instance].State != XSPI_ASYNC_IDLE)
   {
-    return BSP_ERROR_COMPONENT_FAILURE;
+    XSPI_AsyncComplete(instance, BSP_ERROR_PERIPH_FAILURE);
+  }
+  else
+  {
+    Xspi_PollStatus[instance] = BSP_ERROR_PERIPH_FAILURE;
   }
+}
 
-  if ((reg & MX25R3235F_SR_QE) != 0U)
+/**
+  * @brief  Run the next step of the on-going asynchronous operation.
+  *         Called under interrupt at the end of each step.
+  * @param  Instance  XSPI instance
+  * @retval None
+  */
+static void XSPI_AsyncProcess(uint32_t Instance)
+{
+  XSPI_AsyncCtx_t *ctx = &Xspi_Async[Instance];
+  XSPI_RegularCmdTypeDef s_command = {0};
+  int32_t ret = BSP_ERROR_NONE;
+
+  switch (ctx->State)
   {
-    return BSP_ERROR_COMPONENT_FAILURE;
+    case XSPI_ASYNC_WAIT_READY :  /* Memory ready: enable write operations for the next page */
+      if (ctx->Address >= ctx->EndAddress)
+      {
+        XSPI_AsyncComplete(Instance, BSP_ERROR_NONE);
+      }
+      else
+      {
+        ctx->State = XSPI_ASYNC_WRITE_ENABLE;
+        XSPI_InitCommand(&s_command, XSPI_NOR_CMD_WREN);
+        if (HAL_XSPI_Command_IT(&hxspi[Instance], &s_command) != HAL_OK)
+        {
+          ret = BSP_ERROR_PERIPH_FAILURE;
+        }
+      }
+      break;
+
+    case XSPI_ASYNC_WRITE_ENABLE :  /* Write enabled: issue the page program command */
+      ctx->State = XSPI_ASYNC_PROGRAM;
+      XSPI_InitProgramCommand(Instance, &s_command, ctx->Address, ctx->Size);
+      /* No _IT variant with a data phase: the XSPI is free after the write enable, the
+         command only programs its registers */
+      if (HAL_XSPI_Command(&hxspi[Instance], &s_command, XSPI_ASYNC_CMD_TIMEOUT) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+      else if (HAL_XSPI_Transmit_DMA(&hxspi[Instance], (uint8_t *)ctx->pData) != HAL_OK)
+#else
+      else if (HAL_XSPI_Transmit_IT(&hxspi[Instance], (uint8_t *)ctx->pData) != HAL_OK)
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      break;
+
+    case XSPI_ASYNC_PROGRAM :  /* Page sent: prepare the next one and wait for end of program */
+      ctx->Address += ctx->Size;
+      ctx->pData   += ctx->Size;
+      ctx->Size     = ((ctx->Address + MX25R3235F_PAGE_SIZE) > ctx->EndAddress)
+                      ? (ctx->EndAddress - ctx->Address)
+                      : MX25R3235F_PAGE_SIZE;
+      ctx->State    = XSPI_ASYNC_WAIT_READY;
+      ret = XSPI_StartAutoPolling(Instance, XSPI_ASYNC_CMD_TIMEOUT);
+      break;
+
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+    case XSPI_ASYNC_READ :  /* Chunk received: read the next one or end the operation */
+      ctx->Address += ctx->Size;
+      ctx->pRxData += ctx->Size;
+      if (ctx->Address >= ctx->EndAddress)
+      {
+        XSPI_AsyncComplete(Instance, BSP_ERROR_NONE);
+      }
+      else
+      {
+        ctx->Size = ((ctx->EndAddress - ctx->Address) > BSP_XSPI_DMA_MAX_TRANSFER)
+                    ? BSP_XSPI_DMA_MAX_TRANSFER
+                    : (ctx->EndAddress - ctx->Address);
+        ret = XSPI_AsyncReadChunk(Instance, XSPI_ASYNC_CMD_TIMEOUT);
+      }
+      break;
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+
+    case XSPI_ASYNC_IDLE :
+    default :
+      break;
   }
 
-  return BSP_ERROR_NONE;
+  if (ret != BSP_ERROR_NONE)
+  {
+    XSPI_AsyncComplete(Instance, BSP_ERROR_COMPONENT_FAILURE);
+  }
 }
 
 /**
-  * @brief  This function enables delay block.
+  * @brief  End the on-going asynchronous operation and notify the application.
   * @param  Instance  XSPI instance
-  * @retval BSP status
+  * @param  Status    BSP status of the operation
+  * @retval None
   */
-static void XSPI_DLYB_Enable(uint32_t Instance)
+static void XSPI_AsyncComplete(uint32_t Instance, int32_t Status)
 {
-  HAL_XSPI_DLYB_CfgTypeDef  dlyb_cfg;
+  XSPI_AsyncState_t state = Xspi_Async[Instance].State;
 
-  (void)HAL_XSPI_DLYB_GetClockPeriod(&hxspi[Instance], &dlyb_cfg);
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+  /* Restore the FIFO threshold of the indirect mode */
+  (void)HAL_XSPI_SetFifoThreshold(&hxspi[Instance], hxspi[Instance].Init.FifoThresholdByte);
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
 
-  /* PhaseSel is divided by 4 (emperic value)*/
-  dlyb_cfg.PhaseSel /= 4U;
+  Xspi_Async[Instance].State = XSPI_ASYNC_IDLE;
 
-  /*set delay block configuration*/
-  (void)HAL_XSPI_DLYB_SetConfig(&hxspi[Instance], &dlyb_cfg);
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+  if (state == XSPI_ASYNC_READ)
+  {
+#if (USE_BSP_XSPI_STATS == 1)
+    XSPI_StatsAsyncEnd(Instance, BSP_XSPI_STATS_READ, Status);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+    BSP_XSPI_ReadCpltCallback(Instance, Status);
+  }
+  else
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+  {
+    UNUSED(state);
+#if (USE_BSP_XSPI_STATS == 1)
+    XSPI_StatsAsyncEnd(Instance, BSP_XSPI_STATS_WRITE, Status);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+    BSP_XSPI_WriteCpltCallback(Instance, Status);
+  }
 }
 
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
 /**
-  * @brief  Polling WIP(Write In Progress) bit become to 0
-  *         XSPI;
-  * @param  hxspi XSPI handle
+  * @brief  Start the DMA transfer of the current read chunk.
+  * @param  Instance  XSPI instance
+  * @param  Timeout   Timeout of the wait for the XSPI to be free, in ms
   * @retval BSP status
   */
-static int32_t XSPI_AutoPollingMemReady(XSPI_HandleTypeDef *hxspi)
+static int32_t XSPI_AsyncReadChunk(uint32_t Instance, uint32_t Timeout)
 {
-  uint8_t reg;
-  uint32_t timeout = HAL_XSPI_TIMEOUT_DEFAULT_VALUE;
+  XSPI_RegularCmdTypeDef s_command = {0};
+  int32_t ret = BSP_ERROR_NONE;
 
-  reg = 0xFFU;
+  XSPI_InitReadCommand(Instance, &s_command, Xspi_Async[Instance].Address, Xspi_Async[Instance].Size);
 
-  while(((reg & MX25R3235F_SR_WIP) == 1) && (timeout > 0U))
+  if (HAL_XSPI_Command(&hxspi[Instance], &s_command, Timeout) != HAL_OK)
   {
-    if (MX25R3235F_ReadStatusRegister(hxspi, &reg) != MX25R3235F_OK)
-    {
-      return BSP_ERROR_COMPONENT_FAILURE;
-    }
-    timeout--;
+    ret = BSP_ERROR_PERIPH_FAILURE;
   }
-  if ((reg & MX25R3235F_SR_WIP) == 1)
+  else if (HAL_XSPI_Receive_DMA(&hxspi[Instance], Xspi_Async[Instance].pRxData) != HAL_OK)
   {
-    return BSP_ERROR_COMPONENT_FAILURE;
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  XSPI Rx transfer complete callback.
+  * @param  pHxspi XSPI handle
+  * @retval None
+  */
+static void XSPI_RxCpltCallback(XSPI_HandleTypeDef *pHxspi)
+{
+  uint32_t instance = XSPI_GetInstance(pHxspi);
+
+  if (Xspi_Async[instance].State != XSPI_ASYNC_IDLE)
+  {
+    XSPI_AsyncProcess(instance);
   }
-  return BSP_ERROR_NONE;
 }
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
 
 /**
   * @}
@@ -29,6 +29,9 @@ extern "C" {
 #include "stm32wbaxx_nucleo_conf.h"
 #include "stm32wbaxx_nucleo_errno.h"
 #include "../Components/mx25r3235f/mx25r3235f.h"
+#if (USE_BSP_XSPI_TRACE == 1) && (USE_BSP_COM_FEATURE == 1)
+#include "stm32wbaxx_nucleo.h"
+#endif /* (USE_BSP_XSPI_TRACE == 1) && (USE_BSP_COM_FEATURE == 1) */
 
 
 /** @addtogroup BSP
@@ -80,16 +83,275 @@ typedef struct
 #define BSP_XSPI_Transfer_t            MX25R3235F_Transfer_t
 #define BSP_XSPI_Erase_t               MX25R3235F_Erase_t
 
+/* Read commands of the MX25R3235F (instruction-address-data lines) and their dummy cycles.
+   Fastest valid read for each XSPI clock prescaler, with a 100 MHz XSPI kernel clock. The memory
+   runs up to 33 MHz in ultra low power mode (power-on default) and 80 MHz in high performance mode:
+
+   | Prescaler | XSPI clock | Memory power mode | Fastest read, QPI mode | Fastest read, SPI mode |
+   |-----------|------------|-------------------|------------------------|------------------------|
+   |     0     |  100 MHz   | none              | -                      | -                      |
+   |     1     |   50 MHz   | high performance  | 4READ, 6 dummy cycles  | 2READ, 4 dummy cycles  |
+   |   2 to 8  | <= 33 MHz  | any               | 4READ, 6 dummy cycles  | 2READ, 4 dummy cycles  |
+
+   The MX25R3235F dummy cycles do not depend on the clock: DummyCycles should be left to 0 (the
+   datasheet value) unless the mounted memory needs another count. For 4READ, it includes the
+   2 cycles of the mode bits. Other counts must be between the datasheet value of the command
+   and 31, the largest count of the XSPI (33 for 4READ). */
+typedef enum
+{
+  BSP_XSPI_READ_DEFAULT = 0,             /*!<  FAST_READ in SPI mode, 4READ in QPI mode    */
+  BSP_XSPI_READ_FAST,                    /*!<  FAST_READ 1-1-1, 8 dummy cycles             */
+  BSP_XSPI_READ_DREAD,                   /*!<  DREAD 1-1-2, 8 dummy cycles                 */
+  BSP_XSPI_READ_2READ,                   /*!<  2READ 1-2-2, 4 dummy cycles                 */
+  BSP_XSPI_READ_QREAD,                   /*!<  QREAD 1-1-4, 8 dummy cycles, QPI mode only  */
+  BSP_XSPI_READ_4READ                    /*!<  4READ 1-4-4, 6 dummy cycles, QPI mode only  */
+} BSP_XSPI_ReadCommand_t;
+
+typedef enum
+{
+  BSP_XSPI_PROGRAM_DEFAULT = 0,          /*!<  Component page program of the interface mode */
+  BSP_XSPI_PROGRAM_PP,                   /*!<  PP 1-1-1                                     */
+  BSP_XSPI_PROGRAM_4PP                   /*!<  4PP 1-4-4, QPI mode only                     */
+} BSP_XSPI_ProgramCommand_t;
+
+typedef enum
+{
+  BSP_XSPI_ULTRA_LOW_POWER_MODE = 0,     /*!<  Ultra low power mode, up to 33 MHz    */
+  BSP_XSPI_HIGH_PERFORMANCE_MODE         /*!<  High performance mode, up to 80 MHz   */
+} BSP_XSPI_PerformanceMode_t;
+
+typedef enum
+{
+  BSP_XSPI_MMP_DEFAULT = 0,              /*!<  Opcode sent with each access                  */
+  BSP_XSPI_MMP_CONTINUOUS_READ           /*!<  4READ performance enhance, opcode sent once   */
+} BSP_XSPI_MmpOption_t;
+
 typedef struct
 {
   XSPI_Access_t          IsInitialized;  /*!<  Instance access Flash method     */
   BSP_XSPI_Interface_t   InterfaceMode;  /*!<  Flash Interface mode of Instance */
+  BSP_XSPI_ReadCommand_t ReadCommand;    /*!<  Read command of Instance         */
+  uint32_t               DummyCycles;    /*!<  Read dummy cycles, 0 for default */
+  BSP_XSPI_ProgramCommand_t ProgramCommand; /*!<  Page program command of Instance */
+  BSP_XSPI_PerformanceMode_t PerformanceMode; /*!<  Power mode of the memory */
+  BSP_XSPI_MmpOption_t   MmpOption;      /*!<  Memory-mapped mode option        */
 } XSPI_Ctx_t;
 
 typedef struct
 {
   BSP_XSPI_Interface_t   InterfaceMode;  /*!<  Current Flash Interface mode */
 } BSP_XSPI_Init_t;
+
+typedef struct
+{
+  BSP_XSPI_Interface_t   InterfaceMode;  /*!<  Current Flash Interface mode                    */
+  BSP_XSPI_ReadCommand_t ReadCommand;    /*!<  Read command, BSP_XSPI_READ_DEFAULT for the one
+                                               of the interface mode                           */
+  uint32_t               DummyCycles;    /*!<  Read dummy cycles, 0 for the datasheet value    */
+  BSP_XSPI_ProgramCommand_t ProgramCommand; /*!<  Page program command, BSP_XSPI_PROGRAM_DEFAULT
+                                               for the one of the interface mode               */
+} BSP_XSPI_InitEx_t;
+
+typedef struct
+{
+  uint32_t               Hits;           /*!<  Reads served from the cache            */
+  uint32_t               Misses;         /*!<  Reads which needed a line fill         */
+  uint32_t               Evictions;      /*!<  Valid lines replaced by a line fill    */
+} BSP_XSPI_CacheStats_t;
+
+typedef struct
+{
+  uint32_t               Performed;      /*!<  Block erases sent to the memory        */
+  uint32_t               Skipped;        /*!<  Block erases skipped, block was blank  */
+} BSP_XSPI_EraseStats_t;
+
+typedef struct
+{
+  uint32_t               ClockPrescaler; /*!<  XSPI clock prescaler of the measure      */
+  uint32_t               SingleProgram;  /*!<  PP throughput in bytes per second        */
+  uint32_t               QuadProgram;    /*!<  4PP throughput in bytes per second, 0 if
+                                               not measured (SPI mode)                  */
+} BSP_XSPI_ProgramBench_t;
+
+typedef enum
+{
+  BSP_XSPI_WORKLOAD_SEQ_READ = 0,        /*!<  Page reads in address order                    */
+  BSP_XSPI_WORKLOAD_RANDOM_READ,         /*!<  Page reads at random addresses                 */
+  BSP_XSPI_WORKLOAD_SMALL_WRITE,         /*!<  16-byte writes in address order                */
+  BSP_XSPI_WORKLOAD_MIXED                /*!<  70% random page reads, 30% 16-byte writes      */
+} BSP_XSPI_Workload_t;
+
+typedef struct
+{
+  uint32_t               Operations;     /*!<  Operations run                                 */
+  uint32_t               OpsPerSecond;   /*!<  Operations per second                          */
+  uint32_t               BytesPerSecond; /*!<  Bytes read or written per second               */
+  uint32_t               MaxLatency;     /*!<  Longest operation in us                        */
+  uint32_t               P99Latency;     /*!<  99th percentile of the operations in us, upper
+                                               bound of its 1/8 of power of two of cycles,
+                                               at most MaxLatency                            */
+} BSP_XSPI_WorkloadBench_t;
+
+/* Size of the SHA-256 digest of BSP_XSPI_ComputeHash() */
+#define BSP_XSPI_HASH_SIZE            32U
+
+typedef struct
+{
+  uint32_t               Crc;                /*!<  CRC-32 of the area                         */
+  uint32_t               CrcBytesPerSecond;  /*!<  BSP_XSPI_ComputeCRC() throughput            */
+  uint32_t               HashBytesPerSecond; /*!<  BSP_XSPI_ComputeHash() throughput, 0 without
+                                                   the HAL HASH module                        */
+} BSP_XSPI_CrcBench_t;
+
+typedef struct
+{
+  uint32_t               BaseAddress;     /*!<  Alias of the XSPI window in the code area     */
+  uint32_t               RegionSize;      /*!<  ICACHE_REGIONSIZE_xxx                         */
+  uint32_t               OutputBurstType; /*!<  ICACHE_OUTPUT_BURST_INCR or _WRAP             */
+} BSP_XSPI_ICacheConfig_t;
+
+typedef struct
+{
+  uint32_t               ActiveTime;     /*!<  Time spent awake in ms                 */
+  uint32_t               PowerDownTime;  /*!<  Time spent in deep power-down in ms    */
+  uint32_t               WakeUps;        /*!<  Number of wake-ups from deep power-down */
+} BSP_XSPI_PowerStats_t;
+
+typedef struct
+{
+  uint32_t               UncachedCycles; /*!<  CPU cycles of the reads from the XSPI window */
+  uint32_t               CachedCycles;   /*!<  CPU cycles of the reads from the alias       */
+  uint32_t               Hits;           /*!<  ICACHE hits of the reads from the alias      */
+  uint32_t               Misses;         /*!<  ICACHE misses of the reads from the alias    */
+} BSP_XSPI_ICacheBench_t;
+
+typedef struct
+{
+  uint32_t               ClockPrescaler;        /*!<  XSPI clock prescaler                     */
+  uint32_t               SampleShifting;        /*!<  HAL_XSPI_SAMPLE_SHIFT_xxx                */
+  uint32_t               DelayHoldQuarterCycle; /*!<  HAL_XSPI_DHQC_xxx                        */
+  uint32_t               DlybPhaseSel;          /*!<  Delay block phase, 0 for the default one */
+} BSP_XSPI_Calibration_t;
+
+/* Operation types and log2 latency bins of BSP_XSPI_GetStats() */
+#define BSP_XSPI_STATS_OP_NBR         4U
+#define BSP_XSPI_STATS_HISTO_BINS     32U
+
+typedef enum
+{
+  BSP_XSPI_REQUEST_READ = 0,             /*!<  Read of Size bytes at Address into pData       */
+  BSP_XSPI_REQUEST_PROGRAM,              /*!<  Write of Size bytes from pData at Address      */
+  BSP_XSPI_REQUEST_ERASE                 /*!<  Erase of the BlockSize block holding Address   */
+} BSP_XSPI_RequestType_t;
+
+typedef struct
+{
+  BSP_XSPI_RequestType_t Type;           /*!<  Request type                                   */
+  uint32_t               Priority;       /*!<  Requests with higher priority are served first */
+  uint32_t               Address;        /*!<  Memory address                                 */
+  uint32_t               Size;           /*!<  Read/program size                              */
+  BSP_XSPI_Erase_t       BlockSize;      /*!<  Erase block size                               */
+  uint8_t               *pData;          /*!<  Read/program data buffer                       */
+} BSP_XSPI_Request_t;
+
+typedef struct
+{
+  uint8_t               *pData;          /*!<  Data buffer                                    */
+  uint32_t               Size;           /*!<  Size of the buffer in bytes                    */
+} BSP_XSPI_IoVec_t;
+
+typedef struct
+{
+  uint32_t               Instance;       /*!<  XSPI instance, XSPI_INSTANCES_NUMBER once closed */
+  uint32_t               Address;        /*!<  Address of the next span                       */
+  uint32_t               EndAddress;     /*!<  End address of the area                        */
+  uint32_t               Open;           /*!<  BSP_XSPI_CURSOR_OPEN while open                */
+} BSP_XSPI_Cursor_t;
+
+typedef enum
+{
+  BSP_XSPI_STATS_READ = 0,               /*!<  BSP_XSPI_Read(), ReadV(), ReadDMA() to its end */
+  BSP_XSPI_STATS_WRITE,                  /*!<  BSP_XSPI_Write(), WriteV(), WriteAsync() to its end */
+  BSP_XSPI_STATS_ERASE,                  /*!<  Erase command up to its end, suspends included */
+  BSP_XSPI_STATS_FLUSH                   /*!<  Write combining page image program             */
+} BSP_XSPI_StatsOp_t;
+
+typedef struct
+{
+  uint32_t               Count;          /*!<  Successful calls                               */
+  uint32_t               Errors;         /*!<  Failed calls, not in the other fields          */
+  uint32_t               Bytes;          /*!<  Bytes read, written or erased                  */
+  uint64_t               TotalCycles;    /*!<  Sum of the call durations in CPU cycles        */
+  uint32_t               MinCycles;      /*!<  Shortest call                                  */
+  uint32_t               MaxCycles;      /*!<  Longest call                                   */
+  uint32_t               Polls;          /*!<  Status polls during the calls                  */
+  uint32_t               Histogram[BSP_XSPI_STATS_HISTO_BINS]; /*!<  Calls of 2^n to 2^(n+1)-1 cycles */
+} BSP_XSPI_OpStats_t;
+
+typedef struct
+{
+  BSP_XSPI_OpStats_t     Op[BSP_XSPI_STATS_OP_NBR]; /*!<  Statistics per BSP_XSPI_StatsOp_t       */
+  uint32_t               Polls;          /*!<  Status reads by the CPU, or XSPI auto-polling
+                                               runs with USE_BSP_XSPI_IT_FEATURE              */
+  uint32_t               PollTimeouts;   /*!<  Waits for the memory ready ended by a timeout  */
+} BSP_XSPI_Stats_t;
+
+typedef enum
+{
+  BSP_XSPI_TRACE_READ = 0,               /*!<  BSP_XSPI_Read()                                */
+  BSP_XSPI_TRACE_WRITE,                  /*!<  BSP_XSPI_Write()                               */
+  BSP_XSPI_TRACE_FLUSH,                  /*!<  BSP_XSPI_Flush()                               */
+  BSP_XSPI_TRACE_WRITE_ASYNC,            /*!<  BSP_XSPI_WriteAsync(), start of the write      */
+  BSP_XSPI_TRACE_READ_DMA,               /*!<  BSP_XSPI_ReadDMA(), start of the read          */
+  BSP_XSPI_TRACE_ERASE_BLOCK,            /*!<  BSP_XSPI_Erase_Block()                         */
+  BSP_XSPI_TRACE_ERASE_CHIP,             /*!<  BSP_XSPI_Erase_Chip()                          */
+  BSP_XSPI_TRACE_ERASE_RANGE,            /*!<  BSP_XSPI_EraseRange()                          */
+  BSP_XSPI_TRACE_GET_STATUS,             /*!<  BSP_XSPI_GetStatus()                           */
+  BSP_XSPI_TRACE_ENABLE_MMP,             /*!<  BSP_XSPI_EnableMemoryMappedMode(Ex)()          */
+  BSP_XSPI_TRACE_DISABLE_MMP,            /*!<  BSP_XSPI_DisableMemoryMappedMode()             */
+  BSP_XSPI_TRACE_READ_ID,                /*!<  BSP_XSPI_ReadID()                              */
+  BSP_XSPI_TRACE_SUSPEND_ERASE,          /*!<  BSP_XSPI_SuspendErase()                        */
+  BSP_XSPI_TRACE_RESUME_ERASE,           /*!<  BSP_XSPI_ResumeErase()                         */
+  BSP_XSPI_TRACE_SUSPEND_PROGRAM,        /*!<  BSP_XSPI_SuspendProgram()                      */
+  BSP_XSPI_TRACE_RESUME_PROGRAM,         /*!<  BSP_XSPI_ResumeProgram()                       */
+  BSP_XSPI_TRACE_ENTER_POWER_DOWN,       /*!<  BSP_XSPI_EnterDeepPowerDown()                  */
+  BSP_XSPI_TRACE_LEAVE_POWER_DOWN,       /*!<  BSP_XSPI_LeaveDeepPowerDown()                  */
+  BSP_XSPI_TRACE_READV,                  /*!<  BSP_XSPI_ReadV(), total size                   */
+  BSP_XSPI_TRACE_WRITEV,                 /*!<  BSP_XSPI_WriteV(), total size                  */
+  BSP_XSPI_TRACE_INIT,                   /*!<  BSP_XSPI_Init(Ex)(), Size: interface mode      */
+  BSP_XSPI_TRACE_DEINIT,                 /*!<  BSP_XSPI_DeInit()                              */
+  BSP_XSPI_TRACE_STREAM_OPEN,            /*!<  BSP_XSPI_StreamOpen(), area                    */
+  BSP_XSPI_TRACE_STREAM_NEXT,            /*!<  BSP_XSPI_StreamNext(), returned span           */
+  BSP_XSPI_TRACE_STREAM_CLOSE,           /*!<  BSP_XSPI_StreamClose(), cursor address         */
+  BSP_XSPI_TRACE_SUBMIT,                 /*!<  BSP_XSPI_Submit(), request area                */
+  BSP_XSPI_TRACE_PROCESS,                /*!<  BSP_XSPI_Process()                             */
+  BSP_XSPI_TRACE_CALIBRATE,              /*!<  BSP_XSPI_Calibrate(), reserved sector          */
+  BSP_XSPI_TRACE_SET_PERFORMANCE_MODE,   /*!<  BSP_XSPI_SetPerformanceMode(), Size: mode      */
+  BSP_XSPI_TRACE_COMPUTE_CRC,            /*!<  BSP_XSPI_ComputeCRC()                          */
+  BSP_XSPI_TRACE_COMPUTE_HASH            /*!<  BSP_XSPI_ComputeHash()                         */
+} BSP_XSPI_TraceOp_t;
+
+/* Trace record, 20 bytes with no padding */
+typedef struct
+{
+  uint32_t               Tick;           /*!<  HAL tick (ms) at the start of the call         */
+  uint32_t               Cycles;         /*!<  Duration of the call in CPU cycles             */
+  uint32_t               Address;        /*!<  Memory address, 0 if none                      */
+  uint32_t               Size;           /*!<  Bytes read, written or erased, 0 if none       */
+  uint16_t               Sequence;       /*!<  Record number, modulo 65536                    */
+  uint8_t                Op;             /*!<  BSP_XSPI_TraceOp_t, with BSP_XSPI_TRACE_NESTED */
+  int8_t                 Status;         /*!<  BSP status returned by the call                */
+} BSP_XSPI_TraceRecord_t;
+
+/* Header of the trace sent by BSP_XSPI_DumpTrace(), 16 bytes with no padding */
+typedef struct
+{
+  uint32_t               Magic;          /*!<  BSP_XSPI_TRACE_MAGIC                           */
+  uint16_t               Version;        /*!<  BSP_XSPI_TRACE_VERSION                         */
+  uint16_t               RecordSize;     /*!<  Size of a record in bytes                      */
+  uint32_t               NbRecords;      /*!<  Number of records following the header         */
+  uint32_t               CoreClock;      /*!<  CPU clock in Hz, unit of the Cycles fields     */
+} BSP_XSPI_TraceHeader_t;
 /**
   * @}
   */
@@ -106,6 +368,17 @@ typedef struct
 #define XSPI_FORCE_RESET()                __HAL_RCC_XSPI1_FORCE_RESET()
 #define XSPI_RELEASE_RESET()              __HAL_RCC_XSPI1_RELEASE_RESET()
 
+/* Definition for XSPI interrupt */
+#define XSPI_IRQn                         XSPI1_IRQn
+
+/* Definition for XSPI DMA resources */
+#define XSPI_DMA_CLK_ENABLE()             __HAL_RCC_GPDMA1_CLK_ENABLE()
+#define XSPI_DMA_REQUEST                  GPDMA1_REQUEST_XSPI1
+#define XSPI_DMA_RX_CHANNEL               GPDMA1_Channel7
+#define XSPI_DMA_RX_IRQn                  GPDMA1_Channel7_IRQn
+#define XSPI_DMA_TX_CHANNEL               GPDMA1_Channel6
+#define XSPI_DMA_TX_IRQn                  GPDMA1_Channel6_IRQn
+
 /* Definition for XSPI Pins */
 /* XSPI_CS */
 #define XSPI_CS_PIN                       GPIO_PIN_2
@@ -152,16 +425,203 @@ typedef struct
   */
 #define XSPI_INSTANCES_NUMBER         1U
 
+/* Default XSPI features configuration */
+#ifndef USE_BSP_XSPI_IT_FEATURE
+#define USE_BSP_XSPI_IT_FEATURE       0U
+#endif /* USE_BSP_XSPI_IT_FEATURE */
+
+#ifndef USE_BSP_XSPI_DMA_FEATURE
+#define USE_BSP_XSPI_DMA_FEATURE      0U
+#endif /* USE_BSP_XSPI_DMA_FEATURE */
+
+#ifndef BSP_XSPI_IT_PRIORITY
+#define BSP_XSPI_IT_PRIORITY          0x0FUL
+#endif /* BSP_XSPI_IT_PRIORITY */
+
+/* XSPI FIFO threshold and DMA burst length (in bytes) used for DMA transfers */
+#ifndef BSP_XSPI_DMA_FIFO_THRESHOLD
+#define BSP_XSPI_DMA_FIFO_THRESHOLD   4U
+#endif /* BSP_XSPI_DMA_FIFO_THRESHOLD */
+
+/* Maximum size of one DMA transfer: GPDMA block size rounded down to a page multiple.
+   Longer reads are split in chunks of this size chained under interrupt */
+#define BSP_XSPI_DMA_MAX_TRANSFER     0xFF00U
+
+#ifndef USE_BSP_XSPI_READ_CACHE
+#define USE_BSP_XSPI_READ_CACHE       0U
+#endif /* USE_BSP_XSPI_READ_CACHE */
+
+#ifndef BSP_XSPI_CACHE_LINE_SIZE
+#define BSP_XSPI_CACHE_LINE_SIZE      MX25R3235F_SUBSECTOR_4K
+#endif /* BSP_XSPI_CACHE_LINE_SIZE */
+
+#ifndef BSP_XSPI_CACHE_LINES_NBR
+#define BSP_XSPI_CACHE_LINES_NBR      2U
+#endif /* BSP_XSPI_CACHE_LINES_NBR */
+
+#ifndef USE_BSP_XSPI_WRITE_COMBINE
+#define USE_BSP_XSPI_WRITE_COMBINE    0U
+#endif /* USE_BSP_XSPI_WRITE_COMBINE */
+
+#ifndef BSP_XSPI_WRITE_COMBINE_TIMEOUT
+#define BSP_XSPI_WRITE_COMBINE_TIMEOUT 100U
+#endif /* BSP_XSPI_WRITE_COMBINE_TIMEOUT */
+
+#ifndef USE_BSP_XSPI_BLANK_CHECK
+#define USE_BSP_XSPI_BLANK_CHECK      0U
+#endif /* USE_BSP_XSPI_BLANK_CHECK */
+
+/* Size of the stack buffer used by the erase blank check (in bytes, multiple of 4 dividing 4KB) */
+#ifndef BSP_XSPI_BLANK_CHECK_CHUNK
+#define BSP_XSPI_BLANK_CHECK_CHUNK    256U
+#endif /* BSP_XSPI_BLANK_CHECK_CHUNK */
+
+#ifndef USE_BSP_XSPI_WRITE_VERIFY
+#define USE_BSP_XSPI_WRITE_VERIFY     0U
+#endif /* USE_BSP_XSPI_WRITE_VERIFY */
+
+/* Size of the stack buffer used by the write verification (in bytes) */
+#ifndef BSP_XSPI_VERIFY_CHUNK
+#define BSP_XSPI_VERIFY_CHUNK         32U
+#endif /* BSP_XSPI_VERIFY_CHUNK */
+
+#ifndef USE_BSP_XSPI_SCHEDULER
+#define USE_BSP_XSPI_SCHEDULER        0U
+#endif /* USE_BSP_XSPI_SCHEDULER */
+
+#ifndef BSP_XSPI_QUEUE_DEPTH
+#define BSP_XSPI_QUEUE_DEPTH          8U
+#endif /* BSP_XSPI_QUEUE_DEPTH */
+
+#ifndef BSP_XSPI_MAX_ERASE_SUSPEND
+#define BSP_XSPI_MAX_ERASE_SUSPEND    8U
+#endif /* BSP_XSPI_MAX_ERASE_SUSPEND */
+
+#ifndef BSP_XSPI_MAX_PROGRAM_SUSPEND
+#define BSP_XSPI_MAX_PROGRAM_SUSPEND  2U
+#endif /* BSP_XSPI_MAX_PROGRAM_SUSPEND */
+
+#ifndef USE_BSP_XSPI_BENCHMARK
+#define USE_BSP_XSPI_BENCHMARK        0U
+#endif /* USE_BSP_XSPI_BENCHMARK */
+
+/* XSPI clock prescalers of the fastest clock of each performance mode of the memory,
+   33 MHz and 80 MHz, for a 100 MHz XSPI kernel clock */
+#ifndef BSP_XSPI_ULP_PRESCALER
+#define BSP_XSPI_ULP_PRESCALER        2U
+#endif /* BSP_XSPI_ULP_PRESCALER */
+
+#ifndef BSP_XSPI_HP_PRESCALER
+#define BSP_XSPI_HP_PRESCALER         1U
+#endif /* BSP_XSPI_HP_PRESCALER */
+
+#ifndef USE_BSP_XSPI_MMP_ARBITRATION
+#define USE_BSP_XSPI_MMP_ARBITRATION  0U
+#endif /* USE_BSP_XSPI_MMP_ARBITRATION */
+
+#ifndef USE_BSP_XSPI_AUTO_POWER_DOWN
+#define USE_BSP_XSPI_AUTO_POWER_DOWN  0U
+#endif /* USE_BSP_XSPI_AUTO_POWER_DOWN */
+
+/* Time without access in ms after which BSP_XSPI_Process() puts the memory in deep power-down */
+#ifndef BSP_XSPI_POWER_DOWN_TIMEOUT
+#define BSP_XSPI_POWER_DOWN_TIMEOUT   10U
+#endif /* BSP_XSPI_POWER_DOWN_TIMEOUT */
+
+#ifndef USE_BSP_XSPI_WARM_INIT
+#define USE_BSP_XSPI_WARM_INIT        0U
+#endif /* USE_BSP_XSPI_WARM_INIT */
+
+#ifndef USE_BSP_XSPI_ICACHE
+#define USE_BSP_XSPI_ICACHE           0U
+#endif /* USE_BSP_XSPI_ICACHE */
+
+/* Default ICACHE remap region of the memory-mapped window: the whole memory */
+#ifndef BSP_XSPI_ICACHE_BASE
+#define BSP_XSPI_ICACHE_BASE          0x10000000UL
+#endif /* BSP_XSPI_ICACHE_BASE */
+
+#ifndef BSP_XSPI_ICACHE_REGION_SIZE
+#define BSP_XSPI_ICACHE_REGION_SIZE   ICACHE_REGIONSIZE_4MB
+#endif /* BSP_XSPI_ICACHE_REGION_SIZE */
+
+#ifndef BSP_XSPI_ICACHE_BURST
+#define BSP_XSPI_ICACHE_BURST         ICACHE_OUTPUT_BURST_INCR
+#endif /* BSP_XSPI_ICACHE_BURST */
+
+#ifndef USE_BSP_XSPI_VECTOR_IO
+#define USE_BSP_XSPI_VECTOR_IO        0U
+#endif /* USE_BSP_XSPI_VECTOR_IO */
+
+#ifndef USE_BSP_XSPI_STREAM
+#define USE_BSP_XSPI_STREAM           0U
+#endif /* USE_BSP_XSPI_STREAM */
+
+/* Open flag of a cursor: "OPEN" in little endian, unlikely in a zeroed or stale cursor */
+#define BSP_XSPI_CURSOR_OPEN          0x4E45504FUL
+
+#ifndef USE_BSP_XSPI_CRC
+#define USE_BSP_XSPI_CRC              0U
+#endif /* USE_BSP_XSPI_CRC */
+
+#ifndef USE_BSP_XSPI_STATS
+#define USE_BSP_XSPI_STATS            0U
+#endif /* USE_BSP_XSPI_STATS */
+
+#ifndef USE_BSP_XSPI_TRACE
+#define USE_BSP_XSPI_TRACE            0U
+#endif /* USE_BSP_XSPI_TRACE */
+
+/* Records of the trace ring */
+#ifndef BSP_XSPI_TRACE_DEPTH
+#define BSP_XSPI_TRACE_DEPTH          64U
+#endif /* BSP_XSPI_TRACE_DEPTH */
+
+/* Trace dump format: "XSPT" in little endian, then the format version */
+#define BSP_XSPI_TRACE_MAGIC          0x54505358UL
+#define BSP_XSPI_TRACE_VERSION        2U
+
+/* Flag of the record operation: call from an interrupt handler during a recorded call */
+#define BSP_XSPI_TRACE_NESTED         0x80U
+
+#ifndef USE_BSP_XSPI_CALIBRATION
+#define USE_BSP_XSPI_CALIBRATION      0U
+#endif /* USE_BSP_XSPI_CALIBRATION */
+
+/* Reads of the calibration pattern per setting */
+#ifndef BSP_XSPI_CALIB_READS
+#define BSP_XSPI_CALIB_READS          4U
+#endif /* BSP_XSPI_CALIB_READS */
+
+#if (USE_BSP_XSPI_DMA_FEATURE == 1) && (USE_BSP_XSPI_IT_FEATURE == 0)
+#error "USE_BSP_XSPI_DMA_FEATURE requires USE_BSP_XSPI_IT_FEATURE"
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) && (USE_BSP_XSPI_IT_FEATURE == 0) */
+
+#if (USE_BSP_XSPI_ICACHE == 1) && !defined(HAL_ICACHE_MODULE_ENABLED)
+#error "USE_BSP_XSPI_ICACHE requires the HAL ICACHE module"
+#endif /* (USE_BSP_XSPI_ICACHE == 1) && !defined(HAL_ICACHE_MODULE_ENABLED) */
+
+#if (USE_BSP_XSPI_CRC == 1) && !defined(HAL_CRC_MODULE_ENABLED)
+#error "USE_BSP_XSPI_CRC requires the HAL CRC module"
+#endif /* (USE_BSP_XSPI_CRC == 1) && !defined(HAL_CRC_MODULE_ENABLED) */
+
 /* Definition for XSPI modes */
 #define BSP_XSPI_SPI_MODE (BSP_XSPI_Interface_t)MX25R3235F_SPI_MODE      /* 1 Cmd, 1 Address and 1 Data Lines */
 #define BSP_XSPI_QPI_MODE (BSP_XSPI_Interface_t)MX25R3235F_QUAD_IO_MODE  /* 1 Cmd, 4 Address and 4 Data Lines */
 
 /* XSPI erase types */
 #define BSP_XSPI_ERASE_4K             MX25R3235F_ERASE_4K
+#define BSP_XSPI_ERASE_32K            MX25R3235F_ERASE_32K
 #define BSP_XSPI_ERASE_64K            MX25R3235F_ERASE_64K
 
+/* XSPI scheduler request priorities */
+#define BSP_XSPI_PRIORITY_LOW         0U
+#define BSP_XSPI_PRIORITY_NORMAL      1U
+#define BSP_XSPI_PRIORITY_HIGH        2U
+
 /* XSPI block sizes */
 #define BSP_XSPI_BLOCK_4K             MX25R3235F_SUBSECTOR_4K
+#define BSP_XSPI_BLOCK_32K            MX25R3235F_BLOCK_32K
 #define BSP_XSPI_BLOCK_64K            MX25R3235F_SECTOR_64K
 /**
   * @}
@@ -183,7 +643,11 @@ extern XSPI_Ctx_t Xspi_Ctx[XSPI_INSTANCES_NUMBER];
   * @{
   */
 int32_t BSP_XSPI_Init(uint32_t Instance, BSP_XSPI_Init_t *Init);
+int32_t BSP_XSPI_InitEx(uint32_t Instance, BSP_XSPI_InitEx_t *Init);
 int32_t BSP_XSPI_DeInit(uint32_t Instance);
+#if (USE_BSP_XSPI_WARM_INIT == 1)
+int32_t BSP_XSPI_SaveContext(uint32_t Instance);
+#endif /* (USE_BSP_XSPI_WARM_INIT == 1) */
 #if (USE_HAL_XSPI_REGISTER_CALLBACKS == 1)
 int32_t BSP_XSPI_RegisterMspCallbacks(uint32_t Instance, BSP_XSPI_Cb_t *CallBacks);
 int32_t BSP_XSPI_RegisterDefaultMspCallbacks(uint32_t Instance);
@@ -192,15 +656,102 @@ int32_t BSP_XSPI_Read(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint
 int32_t BSP_XSPI_Write(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size);
 int32_t BSP_XSPI_Erase_Block(uint32_t Instance, uint32_t BlockAddress, BSP_XSPI_Erase_t BlockSize);
 int32_t BSP_XSPI_Erase_Chip(uint32_t Instance);
+int32_t BSP_XSPI_EraseRange(uint32_t Instance, uint32_t Address, uint32_t Size);
 int32_t BSP_XSPI_GetStatus(uint32_t Instance);
 int32_t BSP_XSPI_GetInfo(uint32_t Instance, BSP_XSPI_Info_t *pInfo);
 int32_t BSP_XSPI_EnableMemoryMappedMode(uint32_t Instance);
+int32_t BSP_XSPI_EnableMemoryMappedModeEx(uint32_t Instance, BSP_XSPI_MmpOption_t Option);
 int32_t BSP_XSPI_DisableMemoryMappedMode(uint32_t Instance);
 int32_t BSP_XSPI_ReadID(uint32_t Instance, uint8_t *Id);
 int32_t BSP_XSPI_SuspendErase(uint32_t Instance);
 int32_t BSP_XSPI_ResumeErase(uint32_t Instance);
+int32_t BSP_XSPI_SuspendProgram(uint32_t Instance);
+int32_t BSP_XSPI_ResumeProgram(uint32_t Instance);
+int32_t BSP_XSPI_SetPerformanceMode(uint32_t Instance, BSP_XSPI_PerformanceMode_t Mode);
+int32_t BSP_XSPI_GetPerformanceMode(uint32_t Instance, BSP_XSPI_PerformanceMode_t *pMode);
 int32_t BSP_XSPI_EnterDeepPowerDown(uint32_t Instance);
 int32_t BSP_XSPI_LeaveDeepPowerDown(uint32_t Instance);
+#if (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+int32_t BSP_XSPI_GetPowerStats(uint32_t Instance, BSP_XSPI_PowerStats_t *pStats);
+int32_t BSP_XSPI_ResetPowerStats(uint32_t Instance);
+#endif /* (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+#if (USE_BSP_XSPI_IT_FEATURE == 1)
+int32_t BSP_XSPI_WriteAsync(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size);
+void    BSP_XSPI_WriteCpltCallback(uint32_t Instance, int32_t Status);
+void    BSP_XSPI_IRQHandler(uint32_t Instance);
+#endif /* (USE_BSP_XSPI_IT_FEATURE == 1) */
+#if (USE_BSP_XSPI_READ_CACHE == 1)
+int32_t BSP_XSPI_InvalidateCache(uint32_t Instance);
+int32_t BSP_XSPI_GetCacheStats(uint32_t Instance, BSP_XSPI_CacheStats_t *pStats);
+int32_t BSP_XSPI_ResetCacheStats(uint32_t Instance);
+#endif /* (USE_BSP_XSPI_READ_CACHE == 1) */
+#if (USE_BSP_XSPI_BLANK_CHECK == 1)
+int32_t BSP_XSPI_GetEraseStats(uint32_t Instance, BSP_XSPI_EraseStats_t *pStats);
+int32_t BSP_XSPI_ResetEraseStats(uint32_t Instance);
+#endif /* (USE_BSP_XSPI_BLANK_CHECK == 1) */
+#if (USE_BSP_XSPI_STATS == 1)
+int32_t BSP_XSPI_GetStats(uint32_t Instance, BSP_XSPI_Stats_t *pStats);
+int32_t BSP_XSPI_ResetStats(uint32_t Instance);
+#endif /* (USE_BSP_XSPI_STATS == 1) */
+#if (USE_BSP_XSPI_TRACE == 1)
+int32_t BSP_XSPI_GetTrace(uint32_t Instance, BSP_XSPI_TraceRecord_t *pRecords, uint32_t MaxRecords,
+                          uint32_t *pNbRecords);
+int32_t BSP_XSPI_ResetTrace(uint32_t Instance);
+#if (USE_BSP_COM_FEATURE == 1)
+int32_t BSP_XSPI_DumpTrace(uint32_t Instance, COM_TypeDef COM);
+#endif /* (USE_BSP_COM_FEATURE == 1) */
+#endif /* (USE_BSP_XSPI_TRACE == 1) */
+#if (USE_BSP_XSPI_ICACHE == 1)
+int32_t BSP_XSPI_ConfigICache(uint32_t Instance, const BSP_XSPI_ICacheConfig_t *pConfig);
+int32_t BSP_XSPI_InvalidateICache(uint32_t Instance);
+#if (USE_BSP_XSPI_BENCHMARK == 1)
+int32_t BSP_XSPI_BenchmarkICache(uint32_t Instance, uint32_t Address, uint32_t Size, BSP_XSPI_ICacheBench_t *pResult);
+#endif /* (USE_BSP_XSPI_BENCHMARK == 1) */
+#endif /* (USE_BSP_XSPI_ICACHE == 1) */
+#if (USE_BSP_XSPI_CALIBRATION == 1)
+int32_t BSP_XSPI_Calibrate(uint32_t Instance, uint32_t Address, BSP_XSPI_Calibration_t *pCalib);
+int32_t BSP_XSPI_ApplyCalibration(uint32_t Instance, const BSP_XSPI_Calibration_t *pCalib);
+#endif /* (USE_BSP_XSPI_CALIBRATION == 1) */
+#if (USE_BSP_XSPI_BENCHMARK == 1)
+int32_t BSP_XSPI_BenchmarkProgram(uint32_t Instance, uint32_t Address, BSP_XSPI_ProgramBench_t *pResults,
+                                  uint32_t NbResults);
+int32_t BSP_XSPI_BenchmarkWorkload(uint32_t Instance, BSP_XSPI_Workload_t Workload, uint32_t Address,
+                                   uint32_t Size, uint32_t NbOps, BSP_XSPI_WorkloadBench_t *pResult);
+#endif /* (USE_BSP_XSPI_BENCHMARK == 1) */
+#if (USE_BSP_XSPI_VECTOR_IO == 1)
+int32_t BSP_XSPI_ReadV(uint32_t Instance, const BSP_XSPI_IoVec_t *pVec, uint32_t NbVec, uint32_t ReadAddr);
+int32_t BSP_XSPI_WriteV(uint32_t Instance, const BSP_XSPI_IoVec_t *pVec, uint32_t NbVec, uint32_t WriteAddr);
+#endif /* (USE_BSP_XSPI_VECTOR_IO == 1) */
+#if (USE_BSP_XSPI_STREAM == 1)
+int32_t BSP_XSPI_StreamOpen(uint32_t Instance, BSP_XSPI_Cursor_t *pCursor, uint32_t Address, uint32_t Size);
+int32_t BSP_XSPI_StreamNext(BSP_XSPI_Cursor_t *pCursor, uint32_t MaxSize, const uint8_t **ppData, uint32_t *pSize);
+int32_t BSP_XSPI_StreamClose(BSP_XSPI_Cursor_t *pCursor);
+#endif /* (USE_BSP_XSPI_STREAM == 1) */
+#if (USE_BSP_XSPI_CRC == 1)
+int32_t BSP_XSPI_ComputeCRC(uint32_t Instance, uint32_t Address, uint32_t Size, uint32_t *pCrc);
+#if defined(HAL_HASH_MODULE_ENABLED)
+int32_t BSP_XSPI_ComputeHash(uint32_t Instance, uint32_t Address, uint32_t Size, uint8_t *pDigest);
+#endif /* defined(HAL_HASH_MODULE_ENABLED) */
+#if (USE_BSP_XSPI_BENCHMARK == 1)
+int32_t BSP_XSPI_BenchmarkCRC(uint32_t Instance, uint32_t Address, uint32_t Size, BSP_XSPI_CrcBench_t *pResult);
+#endif /* (USE_BSP_XSPI_BENCHMARK == 1) */
+#endif /* (USE_BSP_XSPI_CRC == 1) */
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1)
+int32_t BSP_XSPI_Flush(uint32_t Instance);
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) */
+#if (USE_BSP_XSPI_SCHEDULER == 1)
+int32_t BSP_XSPI_Submit(uint32_t Instance, BSP_XSPI_Request_t *pRequest);
+void    BSP_XSPI_RequestCpltCallback(uint32_t Instance, BSP_XSPI_Request_t *pRequest, int32_t Status);
+#endif /* (USE_BSP_XSPI_SCHEDULER == 1) */
+#if (USE_BSP_XSPI_WRITE_COMBINE == 1) || (USE_BSP_XSPI_SCHEDULER == 1) || (USE_BSP_XSPI_AUTO_POWER_DOWN == 1)
+int32_t BSP_XSPI_Process(uint32_t Instance);
+#endif /* (USE_BSP_XSPI_WRITE_COMBINE == 1) || (USE_BSP_XSPI_SCHEDULER == 1) || (USE_BSP_XSPI_AUTO_POWER_DOWN == 1) */
+#if (USE_BSP_XSPI_DMA_FEATURE == 1)
+int32_t BSP_XSPI_ReadDMA(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size);
+void    BSP_XSPI_ReadCpltCallback(uint32_t Instance, int32_t Status);
+void    BSP_XSPI_DMA_RX_IRQHandler(uint32_t Instance);
+void    BSP_XSPI_DMA_TX_IRQHandler(uint32_t Instance);
+#endif /* (USE_BSP_XSPI_DMA_FEATURE == 1) */
 
 /* These functions can be modified in case the current settings
    need to be changed for specific application needs */